@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <source_location>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "logging.h"
+
+/**
+ * @brief 错误码
+ */
+enum class ErrorCode : std::uint8_t
+{
+    NotFound,        //!< 键不存在
+    NotSet,          //!< 属性未设置
+    Empty,           //!< 输入为空
+    TypeMismatch,    //!< 类型不匹配
+    InvalidArgument, //!< 参数无效
+};
+
+/**
+ * @class ErrorInfo
+ * @brief 错误信息
+ *
+ * @note - 构造时只记录错误码、静态描述、上下文 (如键名) 与出错位置，不进行任何格式化与输出
+ *
+ *       - 仅在调用 message() 或 raise() 时才生成完整的错误信息
+ */
+class ErrorInfo
+{
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param[in] code 错误码
+     * @param[in] what 错误描述 (须为字符串字面量)
+     * @param[in] context 上下文，如键名
+     * @param[in] location 出错位置
+     */
+    ErrorInfo(ErrorCode code, const char *what, std::string context = std::string(),
+              std::source_location location = std::source_location::current())
+        : __code(code), __what(what), __context(std::move(context)), __location(location) {}
+
+    //! 错误码
+    ErrorCode code() const noexcept { return __code; }
+
+    //! 错误描述
+    const char *what() const noexcept { return __what; }
+
+    //! 上下文
+    const std::string &context() const noexcept { return __context; }
+
+    //! 出错位置
+    const std::source_location &location() const noexcept { return __location; }
+
+    /**
+     * @brief 生成完整的错误信息
+     */
+    std::string message() const
+    {
+        return __context.empty() ? std::string(__what) : std::string(__what) + "，键：" + __context;
+    }
+
+    /**
+     * @brief 输出错误信息并抛出异常 (与 VISCORE_THROW_ERROR 一致)
+     */
+    [[noreturn]] void raise() const
+    {
+        viscore_log::throwError(__location.file_name(), static_cast<int>(__location.line()),
+                                __location.function_name(), message());
+    }
+
+private:
+    ErrorCode __code;                 //!< 错误码
+    const char *__what;               //!< 错误描述
+    std::string __context;            //!< 上下文
+    std::source_location __location;  //!< 出错位置
+};
+
+/**
+ * @class Expected
+ * @brief 值或错误信息
+ *
+ * @tparam _Tp 值类型，可以为引用类型 (此时内部保存指针)
+ *
+ * @note - 用于可能合理失败的查询接口，失败路径不产生异常展开与 stderr 输出
+ *
+ *       - 在错误状态下调用 value() 时才通过 ErrorInfo::raise() 抛出异常
+ */
+template <typename _Tp>
+class Expected
+{
+    static constexpr bool is_reference = std::is_reference_v<_Tp>;
+    using ValueType = std::remove_reference_t<_Tp>;
+    using StorageType = std::conditional_t<is_reference, ValueType *, ValueType>;
+
+public:
+    /**
+     * @brief 构造成功结果
+     */
+    template <typename U = _Tp>
+        requires(!std::is_same_v<std::remove_cvref_t<U>, ErrorInfo> && !std::is_same_v<std::remove_cvref_t<U>, Expected> &&
+                 (!is_reference || std::is_lvalue_reference_v<U>)) // 引用结果不可绑定临时对象
+    Expected(U &&value)
+        : __storage(std::in_place_index<0>, makeStorage(std::forward<U>(value))) {}
+
+    /**
+     * @brief 构造失败结果
+     */
+    Expected(ErrorInfo error) : __storage(std::in_place_index<1>, std::move(error)) {}
+
+    //! 是否包含值
+    bool has_value() const noexcept { return __storage.index() == 0; }
+
+    //! 是否包含值
+    explicit operator bool() const noexcept { return has_value(); }
+
+    /**
+     * @brief 获取值
+     *
+     * @note 失败结果调用时抛出异常
+     */
+    ValueType &value()
+    {
+        if (!has_value())
+            std::get<1>(__storage).raise();
+        return get();
+    }
+
+    /**
+     * @brief 获取值
+     *
+     * @note 失败结果调用时抛出异常
+     */
+    const ValueType &value() const
+    {
+        if (!has_value())
+            std::get<1>(__storage).raise();
+        return get();
+    }
+
+    /**
+     * @brief 获取值，失败时返回默认值
+     */
+    template <typename U>
+    std::remove_cv_t<ValueType> value_or(U &&default_value) const
+    {
+        return has_value() ? get() : static_cast<std::remove_cv_t<ValueType>>(std::forward<U>(default_value));
+    }
+
+    //! 获取值 (调用方须保证包含值)
+    ValueType &operator*() noexcept { return get(); }
+    const ValueType &operator*() const noexcept { return get(); }
+    ValueType *operator->() noexcept { return &get(); }
+    const ValueType *operator->() const noexcept { return &get(); }
+
+    /**
+     * @brief 获取错误信息 (调用方须保证不包含值)
+     */
+    const ErrorInfo &error() const noexcept { return *std::get_if<1>(&__storage); }
+
+private:
+    template <typename U>
+    static StorageType makeStorage(U &&value)
+    {
+        if constexpr (is_reference)
+            return std::addressof(value);
+        else
+            return StorageType(std::forward<U>(value));
+    }
+
+    ValueType &get() noexcept
+    {
+        if constexpr (is_reference)
+            return **std::get_if<0>(&__storage);
+        else
+            return *std::get_if<0>(&__storage);
+    }
+
+    const ValueType &get() const noexcept
+    {
+        if constexpr (is_reference)
+            return **std::get_if<0>(&__storage);
+        else
+            return *std::get_if<0>(&__storage);
+    }
+
+private:
+    std::variant<StorageType, ErrorInfo> __storage; //!< 值或错误信息
+};
@@ -1,47 +1,303 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
 
+#ifndef VISCORE_LOG_MIN_LEVEL
 /**
- * @brief 信息打印管理
+ * @brief 编译期最低日志等级，低于该等级的日志在编译期被移除
+ *
+ * @note 0: NORMAL, 1: PASS, 2: HIGHLIGHT, 3: WARNING, 4: ERROR
  */
-#define VISCORE_HIGHLIGHT_INFO(msg...)       \
-    do                                       \
-    {                                        \
-        printf("\033[35m[   INFO   ] " msg); \
-        printf("\033[0m\n");                 \
-    } while (false)
+#define VISCORE_LOG_MIN_LEVEL 0
+#endif
 
-#define VISCORE_WARNING_INFO(msg...)         \
-    do                                       \
-    {                                        \
-        printf("\033[33m[   WARN   ] " msg); \
-        printf("\033[0m\n");                 \
-    } while (false)
+namespace viscore_log
+{
+    /**
+     * @brief 日志等级
+     */
+    enum class Level
+    {
+        Normal = 0,    //!< 普通信息
+        Pass = 1,      //!< 通过信息
+        Highlight = 2, //!< 高亮信息
+        Warning = 3,   //!< 警告
+        Error = 4,     //!< 错误
+    };
 
-#define VISCORE_PASS_INFO(msg...)            \
-    do                                       \
-    {                                        \
-        printf("\033[32m[   PASS   ] " msg); \
-        printf("\033[0m\n");                 \
-    } while (false)
+    /**
+     * @brief 日志调用点，用于按调用点限制日志频率
+     *
+     * @note 每个日志宏展开处持有一个静态实例 (常量初始化，无线程安全初始化开销)
+     */
+    struct CallSite
+    {
+        std::atomic<std::int64_t> window{0};      //!< 当前计数窗口的起始时间 (ns)
+        std::atomic<std::uint32_t> count{0};      //!< 当前窗口内的日志数量
+        std::atomic<std::uint32_t> suppressed{0}; //!< 当前窗口内被丢弃的日志数量
+    };
 
-#define VISCORE_ERROR_INFO(msg...)           \
-    do                                       \
-    {                                        \
-        printf("\033[31m[   ERR    ] " msg); \
-        printf("\033[0m\n");                 \
-    } while (false)
+    //! 记录参数解码函数：按格式字符串与编码后的参数生成文本
+    using Decoder = void (*)(std::string &out, const char *fmt, const unsigned char *payload);
+
+    //! 单条日志参数编码区的容量，超出部分的字符串参数会被截断
+    inline constexpr std::size_t RECORD_PAYLOAD_CAPACITY = 464;
+
+    namespace detail
+    {
+        /**
+         * @brief 调用点频率限制
+         *
+         * @param[in] level 日志等级，高于 setRateLimitLevel 设置的等级时不受限制
+         * @param[in] site 调用点
+         * @param[out] suppressed 上一个窗口被丢弃的日志数量 (窗口切换时非零)
+         *
+         * @return 本条日志是否允许输出
+         */
+        bool admit(Level level, CallSite &site, std::uint32_t &suppressed) noexcept;
+
+        /**
+         * @brief 申请一条日志记录
+         *
+         * @return 参数编码区 (容量 RECORD_PAYLOAD_CAPACITY)，队列已满时返回 nullptr
+         */
+        unsigned char *beginRecord(Level level, const char *fmt, Decoder decoder) noexcept;
+
+        /**
+         * @brief 提交当前线程最近申请的日志记录
+         */
+        void commitRecord() noexcept;
+
+        /**
+         * @brief 输出调用点被丢弃的日志数量
+         */
+        void reportSuppressed(const char *fmt, std::uint32_t suppressed) noexcept;
+
+        //! 参数的保存类型 (字符数组与 char * 统一按 const char * 保存)
+        template <typename _Tp>
+        using arg_t = std::conditional_t<std::is_same_v<std::decay_t<_Tp>, char *>, const char *, std::decay_t<_Tp>>;
+
+        //! 参数是否按字符串编码
+        template <typename _Tp>
+        inline constexpr bool is_string_arg_v = std::is_same_v<_Tp, const char *>;
+
+        //! 参数编码后的固定开销 (字符串为长度与结尾的 '\0')
+        template <typename _Tp>
+        inline constexpr std::size_t fixed_size_v = is_string_arg_v<_Tp> ? sizeof(std::uint16_t) + 1 : sizeof(_Tp);
+
+        /**
+         * @brief 日志参数编解码
+         *
+         * @note - 算术类型、枚举与指针按原始字节保存；字符串复制其内容，调用方的临时字符串可以立即释放
+         *
+         *       - 解码时以保存的参数重新调用 snprintf，格式化在后台线程中完成
+         */
+        template <typename... Args>
+        struct Codec
+        {
+            static_assert(((std::is_arithmetic_v<Args> || std::is_enum_v<Args> || std::is_pointer_v<Args>) && ...),
+                          "日志参数仅支持算术类型、枚举与指针");
+            static_assert((fixed_size_v<Args> + ... + 0) <= RECORD_PAYLOAD_CAPACITY, "日志参数过多");
+
+            //! 编码参数
+            static void encode([[maybe_unused]] unsigned char *payload, const Args &...args) noexcept
+            {
+                [[maybe_unused]] std::size_t string_budget = RECORD_PAYLOAD_CAPACITY - (fixed_size_v<Args> + ... + 0);
+                (encodeArg(payload, string_budget, args), ...);
+            }
+
+            //! 解码参数并格式化
+            static void decode(std::string &out, const char *fmt, [[maybe_unused]] const unsigned char *payload)
+            {
+                // 按参数顺序解码 (花括号初始化保证求值顺序)
+                std::tuple<Args...> values{decodeArg<Args>(payload)...};
+                std::apply([&out, fmt](const auto &...values)
+                           { format(out, fmt, values...); },
+                           values);
+            }
+
+        private:
+            template <typename _Tp>
+            static void encodeArg(unsigned char *&payload, std::size_t &string_budget, const _Tp &arg) noexcept
+            {
+                if constexpr (is_string_arg_v<_Tp>)
+                {
+                    const char *str = arg != nullptr ? arg : "(null)";
+                    const std::size_t length = std::min(std::strlen(str), std::min<std::size_t>(string_budget, UINT16_MAX));
+                    string_budget -= length;
+                    const auto stored = static_cast<std::uint16_t>(length);
+                    std::memcpy(payload, &stored, sizeof(stored));
+                    std::memcpy(payload + sizeof(stored), str, length);
+                    payload[sizeof(stored) + length] = '\0';
+                    payload += sizeof(stored) + length + 1;
+                }
+                else
+                {
+                    std::memcpy(payload, &arg, sizeof(_Tp));
+                    payload += sizeof(_Tp);
+                }
+            }
+
+            template <typename _Tp>
+            static _Tp decodeArg(const unsigned char *&payload) noexcept
+            {
+                if constexpr (is_string_arg_v<_Tp>)
+                {
+                    std::uint16_t length;
+                    std::memcpy(&length, payload, sizeof(length));
+                    auto *str = reinterpret_cast<const char *>(payload + sizeof(length));
+                    payload += sizeof(length) + length + 1;
+                    return str;
+                }
+                else
+                {
+                    _Tp value;
+                    std::memcpy(&value, payload, sizeof(_Tp));
+                    payload += sizeof(_Tp);
+                    return value;
+                }
+            }
 
-#define VISCORE_NORMAL_INFO(msg...)  \
-    do                               \
-    {                                \
-        printf("[   INFO   ] " msg); \
-        printf("\n");                \
+            template <typename... Values>
+            static void format(std::string &out, const char *fmt, const Values &...values)
+            {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#pragma GCC diagnostic ignored "-Wformat-security"
+                const std::size_t offset = out.size();
+                char buffer[512];
+                const int length = std::snprintf(buffer, sizeof(buffer), fmt, values...);
+                if (length < 0)
+                    return;
+                if (static_cast<std::size_t>(length) < sizeof(buffer))
+                {
+                    out.append(buffer, static_cast<std::size_t>(length));
+                    return;
+                }
+                out.resize(offset + static_cast<std::size_t>(length) + 1);
+                std::snprintf(out.data() + offset, static_cast<std::size_t>(length) + 1, fmt, values...);
+                out.resize(offset + static_cast<std::size_t>(length));
+#pragma GCC diagnostic pop
+            }
+        };
+
+        /**
+         * @brief 编码参数并提交一条日志，不经过频率限制
+         */
+        template <typename... Args>
+        inline void submit(Level level, const char *fmt, const Args &...args) noexcept
+        {
+            using ArgCodec = Codec<arg_t<Args>...>;
+            unsigned char *payload = beginRecord(level, fmt, &ArgCodec::decode);
+            if (payload == nullptr)
+                return;
+            ArgCodec::encode(payload, args...);
+            commitRecord();
+        }
+    } // namespace detail
+
+    /**
+     * @brief 写入一条日志
+     *
+     * @note - 调用线程只做频率检查与参数编码，格式化与输出在后台线程中完成
+     *
+     *       - 频率限制默认作用于所有等级，可通过 setRateLimitLevel 使较高等级不受限制
+     *
+     *       - 环境变量 VISCORE_LOG_ASYNC=0 时在调用线程中同步输出
+     *
+     *       - 后台线程的队列已满时丢弃该条日志，不阻塞调用线程
+     */
+    template <typename... Args>
+    inline void write(Level level, CallSite &site, const char *fmt, const Args &...args) noexcept
+    {
+        std::uint32_t suppressed = 0;
+        const bool admitted = detail::admit(level, site, suppressed);
+        if (suppressed != 0)
+            detail::reportSuppressed(fmt, suppressed);
+        if (admitted)
+            detail::submit(level, fmt, args...);
+    }
+
+    /**
+     * @brief 等待已提交的日志全部输出
+     *
+     * @note - 正常退出 (atexit) 与 std::terminate 时自动调用
+     *
+     *       - 因信号 (SIGSEGV、SIGKILL 等) 终止时，尚未被后台线程输出的日志会丢失；
+     *         排查崩溃时可设置 VISCORE_LOG_ASYNC=0 使日志同步输出
+     */
+    void flush() noexcept;
+
+    /**
+     * @brief 设置每个调用点每秒最多输出的日志数量 (0 表示不限制，默认 50)
+     *
+     * @note 作用于不高于 setRateLimitLevel 设置的等级
+     */
+    void setRateLimit(std::uint32_t per_second) noexcept;
+
+    /**
+     * @brief 设置受频率限制的最高等级 (默认 Level::Error，即所有等级)
+     *
+     * @note 例如设置为 Level::Highlight 时警告与错误总是被提交
+     */
+    void setRateLimitLevel(Level max_level) noexcept;
+
+    /**
+     * @brief 输出错误信息并抛出 std::runtime_error (输出格式与 VISCORE_THROW_ERROR 一致)
+     *
+     * @param[in] file 文件名
+     * @param[in] line 行号
+     * @param[in] func 函数名
+     * @param[in] message 错误信息
+     */
+    [[noreturn]] void throwError(const char *file, int line, const char *func, const std::string &message);
+} // namespace viscore_log
+
+/**
+ * @brief 日志宏的公共实现
+ *
+ * @note - 低于 VISCORE_LOG_MIN_LEVEL 的日志在编译期移除
+ *
+ *       - 不可达的 printf 调用保留编译器对格式字符串的检查
+ */
+#define VISCORE_LOG_(LEVEL, msg...)                                                     \
+    do                                                                                  \
+    {                                                                                   \
+        if constexpr (static_cast<int>(LEVEL) >= VISCORE_LOG_MIN_LEVEL)                 \
+        {                                                                               \
+            static viscore_log::CallSite _viscore_log_site_;                            \
+            viscore_log::write(LEVEL, _viscore_log_site_, msg);                         \
+        }                                                                               \
+        if (false)                                                                      \
+            printf(msg);                                                                \
     } while (false)
 
+/**
+ * @brief 信息打印管理
+ */
+#define VISCORE_HIGHLIGHT_INFO(msg...) \
+    VISCORE_LOG_(viscore_log::Level::Highlight, "\033[35m[   INFO   ] " msg)
+
+#define VISCORE_WARNING_INFO(msg...) \
+    VISCORE_LOG_(viscore_log::Level::Warning, "\033[33m[   WARN   ] " msg)
+
+#define VISCORE_PASS_INFO(msg...) \
+    VISCORE_LOG_(viscore_log::Level::Pass, "\033[32m[   PASS   ] " msg)
+
+#define VISCORE_ERROR_INFO(msg...) \
+    VISCORE_LOG_(viscore_log::Level::Error, "\033[31m[   ERR    ] " msg)
+
+#define VISCORE_NORMAL_INFO(msg...) \
+    VISCORE_LOG_(viscore_log::Level::Normal, "[   INFO   ] " msg)
+
 /**
  * @brief 带详细信息的异常抛出宏
  * @param ... printf格式的错误信息
@@ -61,6 +317,7 @@
         constexpr const char *_file_ = __FILE__;                                    \
         constexpr int _line_ = __LINE__;                                            \
         constexpr const char *_func_ = __func__;                                    \
+        viscore_log::flush(); /* 先输出此前的异步日志 */                            \
                                                                                     \
         fprintf(stderr, "\033[31m");                                                \
         fprintf(stderr, "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");        \
@@ -0,0 +1,364 @@
+#include "vis_core/core/logging/logging.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace viscore_log;
+
+namespace
+{
+    //! 每个线程的日志队列长度 (2 的幂)
+    constexpr uint32_t ring_capacity = 256;
+    //! 频率限制的计数窗口
+    constexpr int64_t rate_window_ns = 1'000'000'000;
+    //! 后台线程空闲时的轮询间隔
+    constexpr auto idle_interval = chrono::milliseconds(1);
+
+    /**
+     * @brief 日志记录
+     */
+    struct alignas(64) Record
+    {
+        const char *fmt;      //!< 格式字符串 (字符串字面量)
+        Decoder decoder;      //!< 参数解码函数
+        int64_t timestamp;    //!< 提交时间 (ns)
+        Level level;          //!< 日志等级
+        unsigned char payload[RECORD_PAYLOAD_CAPACITY]; //!< 编码后的参数
+    };
+
+    /**
+     * @brief 单生产者单消费者日志队列
+     *
+     * @note 生产者为所属线程，消费者为后台线程 (或持有 drain 锁的 flush 调用方)
+     */
+    struct ThreadRing
+    {
+        alignas(64) atomic<uint32_t> head{0}; //!< 生产者位置
+        alignas(64) atomic<uint32_t> tail{0}; //!< 消费者位置
+        atomic<bool> retired{false};          //!< 所属线程是否已退出
+        atomic<uint64_t> dropped{0};          //!< 队列满时丢弃的日志数量
+        Record records[ring_capacity];        //!< 记录
+    };
+
+    /**
+     * @brief 获取单调时钟 (ns)
+     *
+     * @note 使用粗粒度时钟，仅用于频率限制与跨线程排序
+     */
+    inline int64_t nowNs() noexcept
+    {
+#ifdef CLOCK_MONOTONIC_COARSE
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+#else
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    //! 日志等级对应的结尾 (带颜色的等级需要恢复颜色)
+    inline const char *suffixOf(Level level) noexcept
+    {
+        return level == Level::Normal ? "\n" : "\033[0m\n";
+    }
+
+    //! 格式化一条记录并追加到输出缓冲
+    inline void formatRecord(string &out, const Record &record)
+    {
+        record.decoder(out, record.fmt, record.payload);
+        out += suffixOf(record.level);
+    }
+
+    //! 安装日志后端之前的 terminate 处理函数
+    terminate_handler previous_terminate = nullptr;
+
+    /**
+     * @brief 异步日志后端
+     */
+    class Backend
+    {
+    public:
+        Backend()
+        {
+            const char *async = getenv("VISCORE_LOG_ASYNC");
+            __async = async == nullptr || string(async) != "0";
+        }
+
+        //! 获取后端 (有意不析构，进程退出时由 atexit 回调停止后台线程)
+        static Backend &instance()
+        {
+            static Backend *backend = new Backend();
+            return *backend;
+        }
+
+        //! 是否异步输出
+        bool async() const noexcept { return __async && !__stopped.load(memory_order_acquire); }
+
+        //! 获取当前线程的日志队列
+        ThreadRing *threadRing()
+        {
+            struct Holder
+            {
+                shared_ptr<ThreadRing> ring;
+                ~Holder()
+                {
+                    if (ring)
+                        ring->retired.store(true, memory_order_release);
+                }
+            };
+            thread_local Holder holder;
+            if (!holder.ring)
+            {
+                holder.ring = make_shared<ThreadRing>();
+                lock_guard<mutex> lock(__rings_mutex);
+                __rings.push_back(holder.ring);
+                startOnce();
+            }
+            return holder.ring.get();
+        }
+
+        //! 输出所有队列中已提交的日志
+        void drain()
+        {
+            lock_guard<mutex> drain_lock(__drain_mutex);
+            vector<shared_ptr<ThreadRing>> rings;
+            {
+                lock_guard<mutex> lock(__rings_mutex);
+                rings = __rings;
+            }
+
+            // 收集各队列已提交的记录，按提交时间排序 (同一线程内保持提交顺序)
+            struct Pending
+            {
+                int64_t timestamp;
+                const Record *record;
+            };
+            vector<Pending> pending;
+            vector<uint32_t> heads(rings.size());
+            uint64_t dropped = 0;
+            for (size_t i = 0; i < rings.size(); ++i)
+            {
+                ThreadRing &ring = *rings[i];
+                const uint32_t tail = ring.tail.load(memory_order_relaxed);
+                heads[i] = ring.head.load(memory_order_acquire);
+                for (uint32_t pos = tail; pos != heads[i]; ++pos)
+                {
+                    const Record &record = ring.records[pos & (ring_capacity - 1)];
+                    pending.push_back({record.timestamp, &record});
+                }
+                dropped += ring.dropped.exchange(0, memory_order_relaxed);
+            }
+            stable_sort(pending.begin(), pending.end(), [](const Pending &a, const Pending &b)
+                        { return a.timestamp < b.timestamp; });
+
+            __output.clear();
+            for (const auto &item : pending)
+                formatRecord(__output, *item.record);
+            if (dropped != 0)
+            {
+                char text[96];
+                snprintf(text, sizeof(text), "\033[33m[   WARN   ] 日志队列已满，丢弃 %llu 条日志\033[0m\n",
+                         static_cast<unsigned long long>(dropped));
+                __output += text;
+            }
+            if (!__output.empty())
+            {
+                fwrite(__output.data(), 1, __output.size(), stdout);
+                fflush(stdout);
+            }
+
+            // 释放已输出的记录，并移除已退出且已清空的线程队列
+            for (size_t i = 0; i < rings.size(); ++i)
+                rings[i]->tail.store(heads[i], memory_order_release);
+            lock_guard<mutex> lock(__rings_mutex);
+            __rings.erase(remove_if(__rings.begin(), __rings.end(), [](const shared_ptr<ThreadRing> &ring)
+                                    { return ring->retired.load(memory_order_acquire) &&
+                                             ring->tail.load(memory_order_relaxed) == ring->head.load(memory_order_acquire); }),
+                          __rings.end());
+        }
+
+        //! 异常终止前尽力输出剩余日志 (其他线程正在输出时等待片刻，仍未完成则放弃，避免死锁)
+        void emergencyDrain()
+        {
+            const auto deadline = chrono::steady_clock::now() + chrono::milliseconds(100);
+            while (!__drain_mutex.try_lock())
+            {
+                if (chrono::steady_clock::now() > deadline)
+                    return;
+                this_thread::yield();
+            }
+            __drain_mutex.unlock();
+            drain();
+        }
+
+        //! 停止后台线程并输出剩余日志，之后的日志在调用线程中同步输出
+        void stop()
+        {
+            if (__stopped.exchange(true, memory_order_acq_rel))
+                return;
+            if (__worker.joinable())
+                __worker.join();
+            drain();
+        }
+
+    private:
+        //! 启动后台线程 (调用方持有 __rings_mutex)
+        void startOnce()
+        {
+            if (__started)
+                return;
+            __started = true;
+            __worker = thread([this]
+                              {
+                while (!__stopped.load(memory_order_acquire))
+                {
+                    drain();
+                    this_thread::sleep_for(idle_interval);
+                } });
+            atexit([]
+                   { Backend::instance().stop(); });
+            previous_terminate = set_terminate([]
+                                               {
+                Backend::instance().emergencyDrain();
+                fflush(stdout);
+                if (previous_terminate != nullptr)
+                    previous_terminate();
+                abort(); });
+        }
+
+    private:
+        bool __async = true;                   //!< 是否启用异步输出
+        bool __started = false;                //!< 后台线程是否已启动
+        atomic<bool> __stopped{false};         //!< 后台线程是否已停止
+        mutex __rings_mutex;                   //!< 保护线程队列列表
+        vector<shared_ptr<ThreadRing>> __rings; //!< 线程队列
+        mutex __drain_mutex;                   //!< 保证同一时刻只有一个消费者
+        string __output;                       //!< 输出缓冲 (持有 __drain_mutex 时访问)
+        thread __worker;                       //!< 后台线程
+    };
+
+    //! 每个调用点每秒最多输出的日志数量
+    atomic<uint32_t> rate_limit{50};
+    //! 受频率限制的最高等级
+    atomic<Level> rate_limit_level{Level::Error};
+
+    //! 当前线程正在写入的记录
+    thread_local Record *current_record = nullptr;
+    //! 当前线程正在写入的记录所属队列 (同步输出时为空)
+    thread_local ThreadRing *current_ring = nullptr;
+    //! 同步输出时使用的记录
+    thread_local Record sync_record;
+} // namespace
+
+namespace viscore_log
+{
+    namespace detail
+    {
+        bool admit(Level level, CallSite &site, uint32_t &suppressed) noexcept
+        {
+            suppressed = 0;
+            const uint32_t limit = rate_limit.load(memory_order_relaxed);
+            if (limit == 0 || level > rate_limit_level.load(memory_order_relaxed))
+                return true;
+
+            const int64_t now = nowNs();
+            int64_t window = site.window.load(memory_order_relaxed);
+            if (now - window >= rate_window_ns &&
+                site.window.compare_exchange_strong(window, now, memory_order_relaxed))
+            {
+                site.count.store(0, memory_order_relaxed);
+                suppressed = site.suppressed.exchange(0, memory_order_relaxed);
+            }
+            if (site.count.fetch_add(1, memory_order_relaxed) < limit)
+                return true;
+            site.suppressed.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+
+        unsigned char *beginRecord(Level level, const char *fmt, Decoder decoder) noexcept
+        {
+            Backend &backend = Backend::instance();
+            Record *record = &sync_record;
+            current_ring = nullptr;
+            if (backend.async())
+            {
+                ThreadRing *ring = backend.threadRing();
+                const uint32_t head = ring->head.load(memory_order_relaxed);
+                if (head - ring->tail.load(memory_order_acquire) >= ring_capacity)
+                {
+                    ring->dropped.fetch_add(1, memory_order_relaxed);
+                    return nullptr;
+                }
+                record = &ring->records[head & (ring_capacity - 1)];
+                current_ring = ring;
+            }
+            record->fmt = fmt;
+            record->decoder = decoder;
+            record->level = level;
+            record->timestamp = nowNs();
+            current_record = record;
+            return record->payload;
+        }
+
+        void commitRecord() noexcept
+        {
+            if (current_ring != nullptr)
+            {
+                current_ring->head.store(current_ring->head.load(memory_order_relaxed) + 1, memory_order_release);
+                return;
+            }
+            // 同步输出
+            thread_local string output;
+            output.clear();
+            formatRecord(output, *current_record);
+            fwrite(output.data(), 1, output.size(), stdout);
+        }
+
+        void reportSuppressed(const char *fmt, uint32_t suppressed) noexcept
+        {
+            // 去掉等级前缀，仅显示原格式字符串
+            const char *prefix_end = strstr(fmt, "] ");
+            const char *text = prefix_end != nullptr ? prefix_end + 2 : fmt;
+            // 每个调用点每个窗口至多一条，直接提交，不经过频率限制
+            submit(Level::Warning, "\033[33m[   WARN   ] 上一秒内有 %u 条日志因频率限制被丢弃: %s", suppressed, text);
+        }
+    } // namespace detail
+
+    void flush() noexcept
+    {
+        Backend &backend = Backend::instance();
+        if (backend.async())
+            backend.drain();
+        fflush(stdout);
+    }
+
+    void setRateLimit(uint32_t per_second) noexcept
+    {
+        rate_limit.store(per_second, memory_order_relaxed);
+    }
+
+    void setRateLimitLevel(Level max_level) noexcept
+    {
+        rate_limit_level.store(max_level, memory_order_relaxed);
+    }
+
+    void throwError(const char *file, int line, const char *func, const string &message)
+    {
+        flush();
+        fprintf(stderr, "\033[31m━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+        fprintf(stderr, "[  ERROR  ] %s:%d (%s)\n", file, line, func);
+        fprintf(stderr, "\033[33m%s\033[0m\n", message.c_str());
+        fprintf(stderr, "\033[31m━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\033[0m\n");
+
+        char location[512];
+        snprintf(location, sizeof(location), "%s:%d (%s) | ", file, line, func);
+        throw runtime_error(location + message);
+    }
+} // namespace viscore_log
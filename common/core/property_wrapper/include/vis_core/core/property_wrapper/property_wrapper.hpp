@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include "vis_core/core/logging/logging.h"
+#include "vis_core/core/logging/expected.hpp"
 
 /**
  * @brief 参数展开辅助宏
@@ -28,17 +29,37 @@ public:
     PropertyWrapper(WrapperType &&value) : _value(std::move(value)), _has_value(true) {}
     PropertyWrapper(const WrapperType &value) : _value(value), _has_value(true) {}
 
+    /**
+     * @brief 获取属性值
+     *
+     * @note 属性未设置时抛出异常，错误信息由 tryGetValue 的结果生成
+     */
     [[nodiscard]] const WrapperType &getValue() const
     {
-        if (!_has_value)
-            VISCORE_THROW_ERROR("属性未设置");
-        return _value;  
+        return tryGetValue().value();
     }
 
     WrapperType &getValue()
+    {
+        return tryGetValue().value();
+    }
+
+    /**
+     * @brief 获取属性值 (不抛出异常)
+     *
+     * @return 属性未设置时返回 ErrorCode::NotSet
+     */
+    [[nodiscard]] Expected<const WrapperType &> tryGetValue() const
+    {
+        if (!_has_value)
+            return ErrorInfo(ErrorCode::NotSet, "属性未设置");
+        return _value;
+    }
+
+    [[nodiscard]] Expected<WrapperType &> tryGetValue()
     {
         if (!_has_value)
-            VISCORE_THROW_ERROR("属性未设置");
+            return ErrorInfo(ErrorCode::NotSet, "属性未设置");
         return _value;
     }
 
@@ -73,6 +94,14 @@ private:                                                                   \
     bool isSet##PROPERTY_NAME() const noexcept                             \
     {                                                                      \
         return _##PROPERTY_NAME##_prop.hasValue();                         \
+    }                                                                      \
+    Expected<const _##PROPERTY_NAME##_type &> tryGet##PROPERTY_NAME() const \
+    {                                                                      \
+        return _##PROPERTY_NAME##_prop.tryGetValue();                      \
+    }                                                                      \
+    Expected<_##PROPERTY_NAME##_type &> tryGet##PROPERTY_NAME()            \
+    {                                                                      \
+        return _##PROPERTY_NAME##_prop.tryGetValue();                      \
     }                                                                      \
                                                                            \
     WRITE_SCOPE:                                                           \
@@ -103,6 +132,14 @@ private:
     bool isSet##PROPERTY_NAME() const noexcept                                            \
     {                                                                                     \
         return _##PROPERTY_NAME##_prop.hasValue();                                        \
+    }                                                                                     \
+    Expected<const _##PROPERTY_NAME##_type &> tryGet##PROPERTY_NAME() const                \
+    {                                                                                     \
+        return _##PROPERTY_NAME##_prop.tryGetValue();                                     \
+    }                                                                                     \
+    Expected<_##PROPERTY_NAME##_type &> tryGet##PROPERTY_NAME()                           \
+    {                                                                                     \
+        return _##PROPERTY_NAME##_prop.tryGetValue();                                     \
     }                                                                                     \
                                                                                           \
     WRITE_SCOPE:                                                                          \
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <span>
+#include <vector>
+
+#include "transform6D.hpp"
+#include "vis_core/core/logging/logging.h"
+
+//! 批量位姿变换
+namespace pose_batch
+{
+    //! 仿射变换矩阵类型 [R | t]
+    using AffineType = cv::Matx34d;
+
+    /**
+     * @brief 批量变换的点类型概念
+     *
+     * @note 要求点类型为 3 个连续存放的 double (cv::Point3d、cv::Vec3d)
+     */
+    template <typename T>
+    concept point3d_type = (std::is_same_v<T, cv::Point3d> || std::is_same_v<T, cv::Vec3d>) &&
+                           sizeof(T) == 3 * sizeof(double);
+
+    /**
+     * @brief 将 Transform6D 转换为仿射变换矩阵
+     *
+     * @param[in] transform 位姿变换
+     * @return 仿射变换矩阵 [R | t]
+     */
+    inline AffineType toAffine(const Transform6D &transform)
+    {
+        const auto &r = transform.rmat();
+        const auto &t = transform.tvec();
+        return AffineType(r(0, 0), r(0, 1), r(0, 2), t(0),
+                          r(1, 0), r(1, 1), r(1, 2), t(1),
+                          r(2, 0), r(2, 1), r(2, 2), t(2));
+    }
+
+    /**
+     * @brief 仿射变换矩阵的复合
+     *
+     * @param[in] A_to_B A 到 B 的变换
+     * @param[in] B_to_C B 到 C 的变换
+     * @return A 到 C 的变换 (与 Transform6D 的 operator+ 一致)
+     */
+    inline AffineType compose(const AffineType &A_to_B, const AffineType &B_to_C)
+    {
+        AffineType result;
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                double value = A_to_B(i, 0) * B_to_C(0, j) + A_to_B(i, 1) * B_to_C(1, j) + A_to_B(i, 2) * B_to_C(2, j);
+                result(i, j) = j == 3 ? value + A_to_B(i, 3) : value;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief 将变换链折叠为一个仿射变换矩阵
+     *
+     * @param[in] chain 变换链，依次为 A_to_B, B_to_C, ...
+     * @return 链首到链尾的变换，等价于 chain[0] + chain[1] + ...
+     *
+     * @note 空链返回单位变换
+     */
+    inline AffineType fold(std::span<const Transform6D> chain)
+    {
+        AffineType result(1, 0, 0, 0,
+                          0, 1, 0, 0,
+                          0, 0, 1, 0);
+        for (const auto &transform : chain)
+            result = compose(result, toAffine(transform));
+        return result;
+    }
+
+    /**
+     * @brief 将变换链折叠为一个仿射变换矩阵
+     *
+     * @param[in] first 链首变换
+     * @param[in] rest 后续变换
+     * @return 链首到链尾的变换，等价于 first + rest...
+     */
+    template <typename... Rest>
+        requires(std::is_convertible_v<const Rest &, const Transform6D &> && ...)
+    inline AffineType fold(const Transform6D &first, const Rest &...rest)
+    {
+        AffineType result = toAffine(first);
+        ((result = compose(result, toAffine(rest))), ...);
+        return result;
+    }
+
+    namespace detail
+    {
+        //! 单点变换
+        inline void transformOne(const AffineType &m, double x, double y, double z, double &ox, double &oy, double &oz) noexcept
+        {
+            ox = m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + m(0, 3);
+            oy = m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + m(1, 3);
+            oz = m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + m(2, 3);
+        }
+
+        /**
+         * @brief 交错存储 (xyzxyz...) 的批量变换
+         *
+         * @note 输入输出可以为同一数组
+         */
+        inline void transformInterleaved(const AffineType &m, const double *src, double *dst, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#if CV_SIMD128_64F
+            const cv::v_float64x2 m00 = cv::v_setall_f64(m(0, 0)), m01 = cv::v_setall_f64(m(0, 1)),
+                                  m02 = cv::v_setall_f64(m(0, 2)), m03 = cv::v_setall_f64(m(0, 3));
+            const cv::v_float64x2 m10 = cv::v_setall_f64(m(1, 0)), m11 = cv::v_setall_f64(m(1, 1)),
+                                  m12 = cv::v_setall_f64(m(1, 2)), m13 = cv::v_setall_f64(m(1, 3));
+            const cv::v_float64x2 m20 = cv::v_setall_f64(m(2, 0)), m21 = cv::v_setall_f64(m(2, 1)),
+                                  m22 = cv::v_setall_f64(m(2, 2)), m23 = cv::v_setall_f64(m(2, 3));
+            for (; i + 2 <= count; i += 2)
+            {
+                cv::v_float64x2 x, y, z;
+                cv::v_load_deinterleave(src + 3 * i, x, y, z);
+                const cv::v_float64x2 ox = cv::v_fma(m00, x, cv::v_fma(m01, y, cv::v_fma(m02, z, m03)));
+                const cv::v_float64x2 oy = cv::v_fma(m10, x, cv::v_fma(m11, y, cv::v_fma(m12, z, m13)));
+                const cv::v_float64x2 oz = cv::v_fma(m20, x, cv::v_fma(m21, y, cv::v_fma(m22, z, m23)));
+                cv::v_store_interleave(dst + 3 * i, ox, oy, oz);
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                const double *p = src + 3 * i;
+                double *q = dst + 3 * i;
+                transformOne(m, p[0], p[1], p[2], q[0], q[1], q[2]);
+            }
+        }
+
+        /**
+         * @brief 分量分离存储 (SoA) 的批量变换
+         *
+         * @note 输入输出可以为同一组数组
+         */
+        inline void transformSoA(const AffineType &m, const double *x, const double *y, const double *z,
+                                 double *ox, double *oy, double *oz, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#if CV_SIMD128_64F
+            const cv::v_float64x2 m00 = cv::v_setall_f64(m(0, 0)), m01 = cv::v_setall_f64(m(0, 1)),
+                                  m02 = cv::v_setall_f64(m(0, 2)), m03 = cv::v_setall_f64(m(0, 3));
+            const cv::v_float64x2 m10 = cv::v_setall_f64(m(1, 0)), m11 = cv::v_setall_f64(m(1, 1)),
+                                  m12 = cv::v_setall_f64(m(1, 2)), m13 = cv::v_setall_f64(m(1, 3));
+            const cv::v_float64x2 m20 = cv::v_setall_f64(m(2, 0)), m21 = cv::v_setall_f64(m(2, 1)),
+                                  m22 = cv::v_setall_f64(m(2, 2)), m23 = cv::v_setall_f64(m(2, 3));
+            for (; i + 2 <= count; i += 2)
+            {
+                const cv::v_float64x2 vx = cv::v_load(x + i), vy = cv::v_load(y + i), vz = cv::v_load(z + i);
+                cv::v_store(ox + i, cv::v_fma(m00, vx, cv::v_fma(m01, vy, cv::v_fma(m02, vz, m03))));
+                cv::v_store(oy + i, cv::v_fma(m10, vx, cv::v_fma(m11, vy, cv::v_fma(m12, vz, m13))));
+                cv::v_store(oz + i, cv::v_fma(m20, vx, cv::v_fma(m21, vy, cv::v_fma(m22, vz, m23))));
+            }
+#endif
+            for (; i < count; ++i)
+                transformOne(m, x[i], y[i], z[i], ox[i], oy[i], oz[i]);
+        }
+    } // namespace detail
+
+    /**
+     * @brief 批量变换三维点
+     *
+     * @param[in] transform 仿射变换矩阵 (可由 fold 得到)
+     * @param[in] src 输入点
+     * @param[out] dst 输出点，数量须与输入一致，可以与输入为同一数组
+     */
+    template <point3d_type Point>
+    inline void transformPoints(const AffineType &transform, std::span<const Point> src, std::span<Point> dst)
+    {
+        if (src.size() != dst.size())
+            VISCORE_THROW_ERROR("输入点数量 (%zu) 与输出点数量 (%zu) 不一致", src.size(), dst.size());
+        detail::transformInterleaved(transform, reinterpret_cast<const double *>(src.data()),
+                                     reinterpret_cast<double *>(dst.data()), src.size());
+    }
+
+    /**
+     * @brief 批量变换三维点
+     *
+     * @param[in] transform 位姿变换
+     * @param[in] src 输入点
+     * @param[out] dst 输出点，数量须与输入一致，可以与输入为同一数组
+     */
+    template <point3d_type Point>
+    inline void transformPoints(const Transform6D &transform, std::span<const Point> src, std::span<Point> dst)
+    {
+        transformPoints(toAffine(transform), src, dst);
+    }
+
+    /**
+     * @brief 批量变换三维点
+     *
+     * @param[in] transform 仿射变换矩阵或位姿变换
+     * @param[in] src 输入点
+     * @return 变换后的点
+     */
+    template <point3d_type Point, typename TransformType>
+        requires(std::is_same_v<TransformType, AffineType> || std::is_same_v<TransformType, Transform6D>)
+    inline std::vector<Point> transformPoints(const TransformType &transform, const std::vector<Point> &src)
+    {
+        std::vector<Point> dst(src.size());
+        transformPoints<Point>(transform, std::span<const Point>(src), std::span<Point>(dst));
+        return dst;
+    }
+
+    /**
+     * @brief 分量分离存储 (SoA) 的点云
+     *
+     * @note 大规模点云优先使用该存储方式，批量变换时无需交错读写
+     */
+    struct PointCloudSoA
+    {
+        std::vector<double> x; //!< x 分量
+        std::vector<double> y; //!< y 分量
+        std::vector<double> z; //!< z 分量
+
+        PointCloudSoA() = default;
+
+        /**
+         * @brief 构造指定数量的点云
+         */
+        explicit PointCloudSoA(std::size_t count) : x(count), y(count), z(count) {}
+
+        /**
+         * @brief 由交错存储的点构造
+         */
+        template <point3d_type Point>
+        explicit PointCloudSoA(std::span<const Point> points) : PointCloudSoA(points.size())
+        {
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                const double *p = reinterpret_cast<const double *>(&points[i]);
+                x[i] = p[0];
+                y[i] = p[1];
+                z[i] = p[2];
+            }
+        }
+
+        //! 点的数量
+        std::size_t size() const noexcept { return x.size(); }
+
+        //! 调整点的数量
+        void resize(std::size_t count)
+        {
+            x.resize(count);
+            y.resize(count);
+            z.resize(count);
+        }
+    };
+
+    /**
+     * @brief 批量变换分量分离存储的点云
+     *
+     * @param[in] transform 仿射变换矩阵
+     * @param[in] src 输入点云
+     * @param[out] dst 输出点云，数量不一致时自动调整，可以与输入为同一对象
+     */
+    inline void transformPoints(const AffineType &transform, const PointCloudSoA &src, PointCloudSoA &dst)
+    {
+        if (src.x.size() != src.y.size() || src.x.size() != src.z.size())
+            VISCORE_THROW_ERROR("点云各分量数量不一致: x = %zu, y = %zu, z = %zu", src.x.size(), src.y.size(), src.z.size());
+        if (&src != &dst)
+            dst.resize(src.size());
+        detail::transformSoA(transform, src.x.data(), src.y.data(), src.z.data(),
+                             dst.x.data(), dst.y.data(), dst.z.data(), src.size());
+    }
+
+    /**
+     * @brief 批量变换分量分离存储的点云
+     *
+     * @param[in] transform 位姿变换
+     * @param[in] src 输入点云
+     * @param[out] dst 输出点云，数量不一致时自动调整，可以与输入为同一对象
+     */
+    inline void transformPoints(const Transform6D &transform, const PointCloudSoA &src, PointCloudSoA &dst)
+    {
+        transformPoints(toAffine(transform), src, dst);
+    }
+} // namespace pose_batch
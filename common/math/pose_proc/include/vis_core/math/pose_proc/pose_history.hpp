@@ -0,0 +1,260 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "transform6D.hpp"
+#include "vis_core/core/logging/expected.hpp"
+
+/**
+ * @class PoseHistory
+ * @brief 带时间戳的位姿历史环形缓冲区
+ *
+ * 1. 保存某一坐标系变换 (如 camera_to_world) 最近的若干个样本，时间戳单位为 ns，须严格递增
+ * 2. 单写者多读者：写线程 (如 1 kHz 的 IMU 线程) 调用 push，任意多个读线程调用 sample / latest
+ * 3. 每个槽位使用独立的顺序锁，写入不等待读者，读者不阻塞写者，读到被覆盖的槽位时重试
+ * 4. 查询时按时间二分查找相邻样本，旋转使用球面线性插值、平移使用线性插值
+ *
+ * @note - 只允许一个线程调用 push
+ *
+ *       - 查询时间早于最早样本或晚于最新样本时返回错误信息，不进行外推
+ */
+class PoseHistory
+{
+public:
+    using Ptr = std::shared_ptr<PoseHistory>; //!< 智能指针类型
+
+    /**
+     * @brief 位姿样本
+     */
+    struct Sample
+    {
+        std::int64_t stamp = 0; //!< 时间戳 (ns)
+        Transform6D transform;  //!< 位姿变换
+    };
+
+private:
+    /**
+     * @brief 槽位
+     *
+     * @note sequence 为顺序锁计数：写入第 n 个样本时为 2n+1，写入完成后为 2n+2
+     */
+    struct Slot
+    {
+        std::atomic<std::uint64_t> sequence{0}; //!< 顺序锁计数
+        std::atomic<std::int64_t> stamp{0};     //!< 时间戳
+        std::atomic<double> quat[4];            //!< 单位四元数 (w, x, y, z)
+        std::atomic<double> tvec[3];            //!< 平移向量
+    };
+
+    static_assert(std::atomic<double>::is_always_lock_free, "位姿历史要求 double 原子操作无锁");
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param[in] capacity 最少保存的样本数量，向上取整为 2 的幂
+     *
+     * @note 插值需要两个相邻样本，容量至少为 2
+     */
+    explicit PoseHistory(std::size_t capacity)
+    {
+        __capacity = 2;
+        while (__capacity < capacity)
+            __capacity <<= 1;
+        __slots = std::make_unique<Slot[]>(__capacity);
+    }
+
+    /**
+     * @brief 构造接口
+     *
+     * @param[in] capacity 最少保存的样本数量，向上取整为 2 的幂 (至少为 2)
+     */
+    static Ptr create(std::size_t capacity) { return std::make_shared<PoseHistory>(capacity); }
+
+    //! 容量
+    std::size_t capacity() const noexcept { return __capacity; }
+
+    //! 当前保存的样本数量
+    std::size_t size() const noexcept
+    {
+        const std::uint64_t head = __head.load(std::memory_order_acquire);
+        return head < __capacity ? head : __capacity;
+    }
+
+    /**
+     * @brief 写入样本 (仅限写线程)
+     *
+     * @param[in] stamp 时间戳 (ns)，须大于上一个样本的时间戳
+     * @param[in] transform 位姿变换
+     *
+     * @return 是否写入成功，时间戳不递增时丢弃该样本
+     */
+    bool push(std::int64_t stamp, const Transform6D &transform)
+    {
+        const std::uint64_t head = __head.load(std::memory_order_relaxed);
+        if (head != 0 && stamp <= __last_stamp)
+        {
+            VISCORE_WARNING_INFO("PoseHistory : 时间戳未递增，丢弃样本 (%lld <= %lld)",
+                                 static_cast<long long>(stamp), static_cast<long long>(__last_stamp));
+            return false;
+        }
+        const Transform6D::QuatType &quat = transform.quat();
+        const Transform6D::TvecType &tvec = transform.tvec();
+
+        Slot &slot = __slots[head & (__capacity - 1)];
+        slot.sequence.store(2 * head + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.stamp.store(stamp, std::memory_order_relaxed);
+        for (int i = 0; i < 4; ++i)
+            slot.quat[i].store(quat(i), std::memory_order_relaxed);
+        for (int i = 0; i < 3; ++i)
+            slot.tvec[i].store(tvec(i), std::memory_order_relaxed);
+        slot.sequence.store(2 * head + 2, std::memory_order_release);
+
+        __last_stamp = stamp;
+        __head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 获取最新样本
+     *
+     * @return 最新样本，缓冲区为空时返回错误信息
+     */
+    Expected<Sample> latest() const
+    {
+        for (int attempt = 0; attempt < __max_attempts; ++attempt)
+        {
+            const std::uint64_t head = __head.load(std::memory_order_acquire);
+            if (head == 0)
+                return ErrorInfo(ErrorCode::Empty, "位姿历史为空");
+            Sample sample;
+            if (readSample(head - 1, sample))
+                return sample;
+        }
+        return ErrorInfo(ErrorCode::NotFound, "位姿历史读取失败 (写入过于频繁)");
+    }
+
+    /**
+     * @brief 查询指定时刻的位姿
+     *
+     * @param[in] stamp 查询时间 (ns)
+     *
+     * @return 插值得到的位姿，查询时间超出缓冲区范围时返回错误信息
+     */
+    Expected<Transform6D> sample(std::int64_t stamp) const
+    {
+        for (int attempt = 0; attempt < __max_attempts; ++attempt)
+        {
+            const std::uint64_t head = __head.load(std::memory_order_acquire);
+            if (head == 0)
+                return ErrorInfo(ErrorCode::Empty, "位姿历史为空");
+            // 最旧的槽位可能正被覆盖，此时顺序锁校验失败并重试
+            const std::uint64_t oldest = head > __capacity ? head - __capacity : 0;
+            const std::uint64_t newest = head - 1;
+
+            std::int64_t oldest_stamp = 0, newest_stamp = 0;
+            if (!readStamp(oldest, oldest_stamp) || !readStamp(newest, newest_stamp))
+                continue;
+            if (stamp < oldest_stamp || stamp > newest_stamp)
+                return ErrorInfo(ErrorCode::NotFound, "查询时间超出位姿历史范围", std::to_string(stamp));
+
+            // 二分查找第一个时间戳不小于 stamp 的样本
+            std::uint64_t lo = oldest, hi = newest;
+            bool overwritten = false;
+            while (lo < hi)
+            {
+                const std::uint64_t mid = lo + (hi - lo) / 2;
+                std::int64_t mid_stamp = 0;
+                if (!readStamp(mid, mid_stamp))
+                {
+                    overwritten = true;
+                    break;
+                }
+                if (mid_stamp < stamp)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            if (overwritten)
+                continue;
+
+            Sample after;
+            if (!readSample(lo, after))
+                continue;
+            if (after.stamp == stamp || lo == oldest)
+                return std::move(after.transform);
+            Sample before;
+            if (!readSample(lo - 1, before))
+                continue;
+            const double ratio = static_cast<double>(stamp - before.stamp) / static_cast<double>(after.stamp - before.stamp);
+            return transform6D_utils::interpolate(before.transform, after.transform, ratio);
+        }
+        return ErrorInfo(ErrorCode::NotFound, "位姿历史读取失败 (写入过于频繁)");
+    }
+
+private:
+    /**
+     * @brief 开始读取第 index 个样本
+     *
+     * @return 槽位，样本尚未写入或已被覆盖时返回 nullptr
+     */
+    const Slot *beginRead(std::uint64_t index, std::uint64_t &sequence) const noexcept
+    {
+        const Slot &slot = __slots[index & (__capacity - 1)];
+        sequence = slot.sequence.load(std::memory_order_acquire);
+        return sequence == 2 * index + 2 ? &slot : nullptr;
+    }
+
+    //! 确认读取期间槽位未被改写
+    static bool endRead(const Slot &slot, std::uint64_t sequence) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    //! 读取第 index 个样本的时间戳
+    bool readStamp(std::uint64_t index, std::int64_t &stamp) const noexcept
+    {
+        std::uint64_t sequence = 0;
+        const Slot *slot = beginRead(index, sequence);
+        if (slot == nullptr)
+            return false;
+        stamp = slot->stamp.load(std::memory_order_relaxed);
+        return endRead(*slot, sequence);
+    }
+
+    //! 读取第 index 个样本
+    bool readSample(std::uint64_t index, Sample &sample) const
+    {
+        std::uint64_t sequence = 0;
+        const Slot *slot = beginRead(index, sequence);
+        if (slot == nullptr)
+            return false;
+        const std::int64_t stamp = slot->stamp.load(std::memory_order_relaxed);
+        Transform6D::QuatType quat;
+        Transform6D::TvecType tvec;
+        for (int i = 0; i < 4; ++i)
+            quat(i) = slot->quat[i].load(std::memory_order_relaxed);
+        for (int i = 0; i < 3; ++i)
+            tvec(i) = slot->tvec[i].load(std::memory_order_relaxed);
+        if (!endRead(*slot, sequence))
+            return false;
+        sample.stamp = stamp;
+        sample.transform = Transform6D(quat, tvec);
+        return true;
+    }
+
+private:
+    static constexpr int __max_attempts = 64; //!< 单次查询的最大重试次数
+
+    std::unique_ptr<Slot[]> __slots;                 //!< 槽位
+    std::size_t __capacity = 0;                      //!< 容量 (2 的幂)
+    alignas(64) std::atomic<std::uint64_t> __head{0}; //!< 已写入的样本总数
+    std::int64_t __last_stamp = 0;                   //!< 上一个样本的时间戳 (仅写线程访问)
+};
+
+using PoseHistory_ptr = std::shared_ptr<PoseHistory>; //!< 位姿历史智能指针类型
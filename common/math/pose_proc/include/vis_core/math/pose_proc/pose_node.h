@@ -1,3 +1,413 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "transform6D.hpp"
+#include "vis_core/core/logging/expected.hpp"
+
+/**
+ * @class FrameId
+ * @brief 坐标系标识
+ *
+ * @note - 坐标系名称在进程内全局驻留 (intern)，同名坐标系总是得到相同的标识
+ *
+ *       - 标识为从 0 开始连续分配的整数，查找时不再需要字符串哈希
+ *
+ *       - 建议在初始化阶段驻留常用坐标系并保存其标识，如 `static const FrameId CAMERA = FrameId::intern("camera");`
+ */
+class FrameId
+{
+public:
+    using ValueType = std::uint32_t;                       //!< 标识的整数类型
+    static constexpr ValueType INVALID = ~ValueType(0); //!< 无效标识
+
+    /**
+     * @brief 构造无效标识
+     */
+    constexpr FrameId() noexcept = default;
+
+    /**
+     * @brief 驻留坐标系名称
+     *
+     * @param[in] name 坐标系名称
+     * @return 坐标系标识，名称首次出现时分配新的标识
+     */
+    static FrameId intern(std::string_view name);
+
+    /**
+     * @brief 查找已驻留的坐标系名称
+     *
+     * @param[in] name 坐标系名称
+     * @return 坐标系标识，名称未驻留时返回无效标识
+     */
+    static FrameId find(std::string_view name);
+
+    //! 坐标系名称，无效标识返回 "<invalid>"
+    const std::string &name() const;
+
+    //! 标识的整数值
+    constexpr ValueType value() const noexcept { return __value; }
+
+    //! 是否为有效标识
+    constexpr bool valid() const noexcept { return __value != INVALID; }
+
+    constexpr bool operator==(const FrameId &other) const noexcept = default;
+
+private:
+    explicit constexpr FrameId(ValueType value) noexcept : __value(value) {}
+
+    ValueType __value = INVALID; //!< 标识的整数值
+};
+
+template <>
+struct std::hash<FrameId>
+{
+    std::size_t operator()(const FrameId &id) const noexcept { return id.value(); }
+};
+
+namespace pose_node_detail
+{
+    //! 支持 string_view 异构查找的字符串哈希
+    struct StringHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>()(str); }
+    };
+
+    /**
+     * @brief 坐标系名称驻留表
+     */
+    struct FrameRegistry
+    {
+        std::shared_mutex mutex;                                                           //!< 读写锁
+        std::unordered_map<std::string, FrameId::ValueType, StringHash, std::equal_to<>> ids; //!< 名称 -> 标识
+        std::deque<std::string> names;                                                     //!< 标识 -> 名称 (元素地址稳定)
+    };
+
+    //! 获取进程内唯一的驻留表
+    inline FrameRegistry &frameRegistry()
+    {
+        static FrameRegistry registry;
+        return registry;
+    }
+}
+
+inline FrameId FrameId::intern(std::string_view name)
+{
+    auto &registry = pose_node_detail::frameRegistry();
+    {
+        std::shared_lock lock(registry.mutex);
+        auto it = registry.ids.find(name);
+        if (it != registry.ids.end())
+            return FrameId(it->second);
+    }
+    std::unique_lock lock(registry.mutex);
+    auto [it, inserted] = registry.ids.try_emplace(std::string(name), static_cast<ValueType>(registry.names.size()));
+    if (inserted)
+        registry.names.emplace_back(name);
+    return FrameId(it->second);
+}
+
+inline FrameId FrameId::find(std::string_view name)
+{
+    auto &registry = pose_node_detail::frameRegistry();
+    std::shared_lock lock(registry.mutex);
+    auto it = registry.ids.find(name);
+    return it != registry.ids.end() ? FrameId(it->second) : FrameId();
+}
+
+inline const std::string &FrameId::name() const
+{
+    static const std::string invalid_name = "<invalid>";
+    if (!valid())
+        return invalid_name;
+    auto &registry = pose_node_detail::frameRegistry();
+    std::shared_lock lock(registry.mutex);
+    return __value < registry.names.size() ? registry.names[__value] : invalid_name;
+}
+
+/**
+ * @class PoseTree
+ * @brief 坐标系树
+ *
+ * 1. 每个坐标系保存相对于父坐标系的变换 parent_to_frame (与 Transform6D 的 A_to_B 约定一致)
+ * 2. 没有父坐标系的坐标系为根 (世界坐标系)，其变换表示相对于世界原点的位姿
+ * 3. 世界变换 world_to_frame 在首次查询时沿父链延迟计算并缓存
+ * 4. 修改某个坐标系的变换时，仅将其自身与所有子孙标记为脏，其余坐标系的缓存保持有效
+ *
+ * @note - 坐标系按 FrameId 的整数值直接索引，查找不涉及哈希
+ *
+ *       - 查询会写入缓存，同一棵树不可被多个线程同时访问
+ */
+class PoseTree
+{
+public:
+    using Ptr = std::shared_ptr<PoseTree>; //!< 智能指针类型
+
+private:
+    /**
+     * @brief 坐标系节点
+     */
+    struct Node
+    {
+        FrameId parent;                     //!< 父坐标系
+        Transform6D parent_to_frame;        //!< 相对于父坐标系的变换
+        mutable Transform6D world_to_frame; //!< 缓存的世界变换
+        mutable bool dirty = true;          //!< 世界变换是否需要重新计算
+        bool valid = false;                 //!< 节点是否存在
+        std::vector<FrameId> children;      //!< 子坐标系
+    };
+
+public:
+    PoseTree() = default;
+
+    /**
+     * @brief 构造接口
+     */
+    static Ptr create() { return std::make_shared<PoseTree>(); }
+
+    /**
+     * @brief 添加或更新坐标系
+     *
+     * @param[in] frame 坐标系
+     * @param[in] parent 父坐标系，无效标识表示根坐标系
+     * @param[in] parent_to_frame 相对于父坐标系的变换
+     *
+     * @note 父坐标系须已存在，且不能为 frame 自身或其子孙
+     */
+    void setFrame(FrameId frame, FrameId parent, const Transform6D &parent_to_frame)
+    {
+        if (!frame.valid())
+            VISCORE_THROW_ERROR("坐标系标识无效");
+        if (parent.valid())
+        {
+            if (!contains(parent))
+                VISCORE_THROW_ERROR("父坐标系不存在: %s", parent.name().c_str());
+            for (FrameId ancestor = parent; ancestor.valid(); ancestor = __nodes[ancestor.value()].parent)
+                if (ancestor == frame)
+                    VISCORE_THROW_ERROR("坐标系 %s 不能以自身或其子孙 %s 为父坐标系", frame.name().c_str(), parent.name().c_str());
+        }
+        if (frame.value() >= __nodes.size())
+            __nodes.resize(frame.value() + 1);
+
+        Node &node = __nodes[frame.value()];
+        if (!node.valid)
+            ++__size;
+        else if (node.parent != parent)
+            detach(frame);
+        if (!node.valid || node.parent != parent)
+        {
+            node.parent = parent;
+            if (parent.valid())
+                __nodes[parent.value()].children.push_back(frame);
+        }
+        node.valid = true;
+        node.parent_to_frame = parent_to_frame;
+        markDirty(frame);
+    }
+
+    /**
+     * @brief 更新坐标系相对于父坐标系的变换
+     *
+     * @param[in] frame 坐标系，须已存在
+     * @param[in] parent_to_frame 相对于父坐标系的变换
+     */
+    void setTransform(FrameId frame, const Transform6D &parent_to_frame)
+    {
+        node(frame).parent_to_frame = parent_to_frame;
+        markDirty(frame);
+    }
+
+    /**
+     * @brief 删除坐标系及其所有子孙
+     *
+     * @param[in] frame 坐标系
+     */
+    void removeFrame(FrameId frame)
+    {
+        if (!contains(frame))
+            return;
+        detach(frame);
+        std::vector<FrameId> pending{frame};
+        while (!pending.empty())
+        {
+            Node &current = __nodes[pending.back().value()];
+            pending.pop_back();
+            pending.insert(pending.end(), current.children.begin(), current.children.end());
+            current = Node();
+            --__size;
+        }
+    }
+
+    //! 坐标系是否存在
+    bool contains(FrameId frame) const noexcept
+    {
+        return frame.valid() && frame.value() < __nodes.size() && __nodes[frame.value()].valid;
+    }
+
+    //! 坐标系数量
+    std::size_t size() const noexcept { return __size; }
+
+    //! 父坐标系，根坐标系返回无效标识
+    FrameId parent(FrameId frame) const { return node(frame).parent; }
+
+    //! 所在树的根坐标系
+    FrameId root(FrameId frame) const
+    {
+        const Node *current = &node(frame);
+        while (current->parent.valid())
+        {
+            frame = current->parent;
+            current = &__nodes[frame.value()];
+        }
+        return frame;
+    }
+
+    //! 相对于父坐标系的变换
+    const Transform6D &localTransform(FrameId frame) const { return node(frame).parent_to_frame; }
+
+    /**
+     * @brief 获取世界变换 world_to_frame
+     *
+     * @param[in] frame 坐标系
+     * @return 相对于根坐标系所在世界原点的变换
+     *
+     * @note 仅重新计算脏的祖先链，结果缓存至下次修改
+     */
+    const Transform6D &worldTransform(FrameId frame) const
+    {
+        const Node &target = node(frame);
+        updateWorld(target);
+        return target.world_to_frame;
+    }
+
+    /**
+     * @brief 获取世界变换 world_to_frame
+     *
+     * @param[in] frame 坐标系
+     * @return 世界变换，坐标系不存在时返回错误信息
+     */
+    Expected<const Transform6D &> tryWorldTransform(FrameId frame) const
+    {
+        if (!contains(frame))
+            return ErrorInfo(ErrorCode::NotFound, "坐标系不存在", frame.name());
+        return worldTransform(frame);
+    }
+
+    /**
+     * @brief 获取两个坐标系之间的变换 from_to_to
+     *
+     * @param[in] from 起始坐标系
+     * @param[in] to 目标坐标系
+     * @return to 坐标系相对于 from 坐标系的变换
+     *
+     * @note 两个坐标系须位于同一棵树
+     */
+    Transform6D transform(FrameId from, FrameId to) const
+    {
+        auto result = tryTransform(from, to);
+        if (!result)
+            result.error().raise();
+        return std::move(*result);
+    }
+
+    /**
+     * @brief 获取两个坐标系之间的变换 from_to_to
+     *
+     * @param[in] from 起始坐标系
+     * @param[in] to 目标坐标系
+     * @return to 坐标系相对于 from 坐标系的变换，坐标系不存在或不在同一棵树时返回错误信息
+     */
+    Expected<Transform6D> tryTransform(FrameId from, FrameId to) const
+    {
+        if (!contains(from))
+            return ErrorInfo(ErrorCode::NotFound, "坐标系不存在", from.name());
+        if (!contains(to))
+            return ErrorInfo(ErrorCode::NotFound, "坐标系不存在", to.name());
+        if (from == to)
+            return Transform6D();
+        if (root(from) != root(to))
+            return ErrorInfo(ErrorCode::InvalidArgument, "坐标系不在同一棵树", from.name() + " -> " + to.name());
+        // 直接父子关系无需经过世界坐标系
+        const Node &to_node = __nodes[to.value()];
+        if (to_node.parent == from)
+            return to_node.parent_to_frame;
+        return Transform6D::compose(worldTransform(from).inverse(), worldTransform(to));
+    }
+
+private:
+    //! 获取已存在的节点
+    const Node &node(FrameId frame) const
+    {
+        if (!contains(frame))
+            VISCORE_THROW_ERROR("坐标系不存在: %s", frame.name().c_str());
+        return __nodes[frame.value()];
+    }
+
+    //! 获取已存在的节点
+    Node &node(FrameId frame) { return const_cast<Node &>(std::as_const(*this).node(frame)); }
+
+    //! 沿父链更新世界变换
+    void updateWorld(const Node &target) const
+    {
+        if (!target.dirty)
+            return;
+        if (target.parent.valid())
+        {
+            const Node &parent = __nodes[target.parent.value()];
+            updateWorld(parent);
+            target.world_to_frame = Transform6D::compose(parent.world_to_frame, target.parent_to_frame);
+        }
+        else
+        {
+            target.world_to_frame = target.parent_to_frame;
+        }
+        target.dirty = false;
+    }
+
+    /**
+     * @brief 将坐标系及其子孙标记为脏
+     *
+     * @note 脏节点的子孙必然为脏，遇到已为脏的子孙时停止向下传播
+     */
+    void markDirty(FrameId frame)
+    {
+        __nodes[frame.value()].dirty = true;
+        std::vector<FrameId> pending(__nodes[frame.value()].children);
+        while (!pending.empty())
+        {
+            Node &current = __nodes[pending.back().value()];
+            pending.pop_back();
+            if (current.dirty)
+                continue;
+            current.dirty = true;
+            pending.insert(pending.end(), current.children.begin(), current.children.end());
+        }
+    }
+
+    //! 从父坐标系的子坐标系列表中移除
+    void detach(FrameId frame)
+    {
+        const FrameId parent = __nodes[frame.value()].parent;
+        if (!parent.valid())
+            return;
+        auto &siblings = __nodes[parent.value()].children;
+        std::erase(siblings, frame);
+    }
+
+private:
+    std::vector<Node> __nodes; //!< 按 FrameId 索引的节点
+    std::size_t __size = 0;    //!< 坐标系数量
+};
+
+using PoseTree_ptr = std::shared_ptr<PoseTree>; //!< 坐标系树智能指针类型
@@ -2,6 +2,10 @@
 
 #include <opencv2/core.hpp>
 #include <opencv2/calib3d.hpp>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
 #include <memory>
 
 #include "vis_core/math/geom_utils/type_utils.hpp"
@@ -40,8 +44,32 @@ namespace transform6D_concepts
      */
     template <typename T>
     concept tvec_type = geom_utils_concepts::vector_3_type<T>;
+
+    /**
+     * @brief 四元数类型概念
+     * @tparam T 四元数类型
+     *
+     * @note 要求 T 为 cv::Vec<Tp, 4>，分量顺序为 (w, x, y, z)
+     */
+    template <typename T>
+    concept quat_type = requires {
+        requires std::is_same_v<base_type<T>, cv::Vec<typename base_type<T>::value_type, 4>>;
+        requires geom_utils_concepts::vector_arithmetic<typename base_type<T>::value_type>;
+    };
 }
 
+/**
+ * @class Transform6D
+ * @brief 六自由度位姿变换
+ *
+ * @note - 旋转部分可由旋转矩阵、旋转向量、单位四元数三种形式表示，未设置的形式在首次访问时延迟计算并缓存
+ *
+ *       - 各形式之间均使用闭式公式转换，不经过 cv::Rodrigues
+ *
+ *       - 复合与求逆在两个操作数均已缓存旋转矩阵时使用矩阵运算，否则使用四元数运算
+ *
+ *       - 延迟计算的线程安全性由初始化模式 InitMode 决定，可逐个实例选择
+ */
 class Transform6D
 {
 public:
@@ -51,35 +79,77 @@ public:
     using RvecType = cv::Vec3d;
     //! 平移向量存储类型
     using TvecType = cv::Vec3d;
+    //! 四元数存储类型 (w, x, y, z)
+    using QuatType = cv::Vec4d;
+
+    /**
+     * @brief 旋转形式的初始化模式
+     */
+    enum class InitMode : std::uint8_t
+    {
+        Lazy,   //!< 首次访问时计算，开销最小，同一实例不可被多个线程同时读取
+        Eager,  //!< 设置时立即计算全部形式，读取不产生任何写入，设置开销较大
+        Atomic, //!< 首次访问时计算，以原子标记保证只计算一次，可被多个线程同时读取
+    };
 
     /**
      * @brief 默认构造函数
      */
-    Transform6D();
+    Transform6D() : Transform6D(InitMode::Lazy) {}
 
-    Transform6D(const Transform6D &other) = default;            
-    Transform6D(Transform6D &&other) = default;                 
-    Transform6D &operator=(const Transform6D &other) = default; 
-    Transform6D &operator=(Transform6D &&other) = default;      
-    ~Transform6D() = default;                                 
+    /**
+     * @brief 构造单位变换
+     *
+     * @param mode 初始化模式
+     */
+    explicit Transform6D(InitMode mode);
 
+    Transform6D(const Transform6D &other) noexcept;
+    Transform6D(Transform6D &&other) noexcept : Transform6D(static_cast<const Transform6D &>(other)) {}
+    Transform6D &operator=(const Transform6D &other) noexcept;
+    Transform6D &operator=(Transform6D &&other) noexcept { return *this = static_cast<const Transform6D &>(other); }
+    ~Transform6D() = default;
 
     /**
      * @brief 构造函数
      * @param rmat 旋转矩阵
      * @param tvec 平移向量
+     * @param mode 初始化模式
      */
     template <transform6D_concepts::rmat_type T, transform6D_concepts::tvec_type U>
-    Transform6D(const T &rmat, const U &tvec);
-
+    Transform6D(const T &rmat, const U &tvec, InitMode mode = InitMode::Lazy);
 
     /**
      * @brief 构造函数
      * @param rvec 旋转向量
      * @param tvec 平移向量
+     * @param mode 初始化模式
      */
     template <transform6D_concepts::rvec_type T, transform6D_concepts::tvec_type U>
-    Transform6D(const T &rvec, const U &tvec);
+    Transform6D(const T &rvec, const U &tvec, InitMode mode = InitMode::Lazy);
+
+    /**
+     * @brief 构造函数
+     * @param quat 单位四元数 (w, x, y, z)
+     * @param tvec 平移向量
+     * @param mode 初始化模式
+     */
+    template <transform6D_concepts::quat_type T, transform6D_concepts::tvec_type U>
+    Transform6D(const T &quat, const U &tvec, InitMode mode = InitMode::Lazy);
+
+    /**
+     * @brief 获取初始化模式
+     */
+    InitMode initMode() const noexcept { return __mode; }
+
+    /**
+     * @brief 设置初始化模式
+     *
+     * @param mode 初始化模式，设置为 Eager 时立即计算全部形式
+     *
+     * @note 不可与读取并发调用
+     */
+    void initMode(InitMode mode) noexcept;
 
     /**
      * @brief 获取旋转矩阵
@@ -99,6 +169,12 @@ public:
      */
     const RvecType &rvec() const noexcept;
 
+    /**
+     * @brief 获取单位四元数
+     * @return 返回单位四元数 (w, x, y, z)
+     */
+    const QuatType &quat() const noexcept;
+
     /**
      * @brief 设置 rmat
      *
@@ -126,19 +202,58 @@ public:
     template <transform6D_concepts::tvec_type T>
     void tvec(const T &tvec) noexcept;
 
+    /**
+     * @brief 设置 quat
+     *
+     * @param quat 单位四元数 (w, x, y, z)
+     */
+    template <transform6D_concepts::quat_type T>
+    void quat(const T &quat) noexcept;
+
+    /**
+     * @brief 位姿复合
+     * @param A_to_B A到B的变换
+     * @param B_to_C B到C的变换
+     * @return A_to_C A到C的变换
+     */
+    static Transform6D compose(const Transform6D &A_to_B, const Transform6D &B_to_C);
+
+    /**
+     * @brief 求逆变换
+     * @return 返回逆变换
+     */
+    Transform6D inverse() const;
+
 private:
-    // 确保旋转矩阵有效（延迟初始化）
-    void ensureRmatInitialized() const;
+    //! 旋转形式的有效标记
+    enum StateFlag : std::uint8_t
+    {
+        RMAT = 1 << 0,  //!< 旋转矩阵有效
+        RVEC = 1 << 1,  //!< 旋转向量有效
+        QUAT = 1 << 2,  //!< 四元数有效
+        BUSY = 1 << 7,  //!< 某个线程正在计算 (仅 Atomic 模式)
+        ALL = RMAT | RVEC | QUAT,
+    };
 
-    // 确保旋转向量有效（延迟初始化）
-    void ensureRvecInitialized() const;
+    // 确保指定形式有效（延迟初始化）
+    void ensureInitialized(std::uint8_t flag) const noexcept;
+
+    // 由已有形式计算指定形式，返回新增的有效标记
+    std::uint8_t computeForm(std::uint8_t flag, std::uint8_t state) const noexcept;
+
+    // 设置某一形式后更新标记
+    void resetState(std::uint8_t flag) noexcept;
+
+    // 指定形式是否已缓存
+    bool hasForm(std::uint8_t flag) const noexcept { return __state.load(std::memory_order_acquire) & flag; }
 
     mutable RmatType __rmat; //!< 旋转矩阵
     mutable RvecType __rvec; //!< 旋转向量
+    mutable QuatType __quat; //!< 单位四元数
     TvecType __tvec;         //!< 平移向量
 
-    mutable bool __rmat_initialized = false; //!< 旋转矩阵初始化标记
-    mutable bool __rvec_initialized = false; //!< 旋转向量初始化标记
+    mutable std::atomic<std::uint8_t> __state{0}; //!< 有效标记 (StateFlag 的组合)
+    InitMode __mode = InitMode::Lazy;             //!< 初始化模式
 };
 
 //! Transform6D 类的辅助函数
@@ -171,84 +286,207 @@ namespace transform6D_utils
     template <transform6D_concepts::tvec_type T>
     Transform6D::TvecType convertTvec(const T &tvec);
 
+    /**
+     * @brief 将四元数转换为 Transform6D 所需的四元数类型并归一化
+     * @tparam T 四元数类型
+     * @param quat 输入的四元数
+     * @return 返回转换后的单位四元数
+     */
+    template <transform6D_concepts::quat_type T>
+    Transform6D::QuatType convertQuat(const T &quat);
+
     /**
      * @brief 将旋转向量转换为 Transform6D 所需的旋转矩阵类型
      * @param rvec 输入的旋转向量
      * @return 返回转换后的旋转矩阵
      */
     Transform6D::RmatType convertRmat(const cv::Matx<Transform6D::RmatType::value_type, 3, 1> &rvec);
+
+    // ---------------【旋转表示的闭式转换】----------------
+
+    //! 旋转向量转单位四元数
+    Transform6D::QuatType rvecToQuat(const Transform6D::RvecType &rvec) noexcept;
+
+    //! 单位四元数转旋转向量
+    Transform6D::RvecType quatToRvec(const Transform6D::QuatType &quat) noexcept;
+
+    //! 单位四元数转旋转矩阵
+    Transform6D::RmatType quatToRmat(const Transform6D::QuatType &quat) noexcept;
+
+    //! 旋转矩阵转单位四元数 (Shepperd 方法)
+    Transform6D::QuatType rmatToQuat(const Transform6D::RmatType &rmat) noexcept;
+
+    //! 四元数乘法 (Hamilton 积)，对应旋转矩阵 R(a) * R(b)
+    Transform6D::QuatType quatMul(const Transform6D::QuatType &a, const Transform6D::QuatType &b) noexcept;
+
+    //! 使用单位四元数旋转向量
+    Transform6D::TvecType quatRotate(const Transform6D::QuatType &quat, const Transform6D::TvecType &v) noexcept;
+
+    //! 单位四元数的共轭 (即逆旋转)
+    Transform6D::QuatType quatConj(const Transform6D::QuatType &quat) noexcept;
+
+    /**
+     * @brief 单位四元数球面线性插值
+     * @param q0 起始四元数
+     * @param q1 终止四元数
+     * @param t 插值系数，0 对应 q0，1 对应 q1
+     * @return 插值结果，沿最短弧插值
+     */
+    Transform6D::QuatType slerp(const Transform6D::QuatType &q0, const Transform6D::QuatType &q1, double t) noexcept;
+
+    /**
+     * @brief 位姿插值
+     * @param T0 起始位姿
+     * @param T1 终止位姿
+     * @param t 插值系数，0 对应 T0，1 对应 T1
+     * @return 旋转使用球面线性插值、平移使用线性插值的结果
+     */
+    Transform6D interpolate(const Transform6D &T0, const Transform6D &T1, double t);
 }
 
-// 默认构造函数
-inline Transform6D::Transform6D()
-    : __tvec(TvecType::zeros())
+// 构造单位变换
+inline Transform6D::Transform6D(InitMode mode)
+    : __tvec(TvecType::zeros()), __mode(mode)
 {
     // 默认构造时不初始化旋转矩阵和旋转向量
+    if (__mode == InitMode::Eager)
+        ensureInitialized(ALL);
+}
+
+// 拷贝构造，仅复制已有效的形式 (Atomic 模式下其余形式可能正被其他线程写入)
+inline Transform6D::Transform6D(const Transform6D &other) noexcept
+{
+    *this = other;
+}
+
+inline Transform6D &Transform6D::operator=(const Transform6D &other) noexcept
+{
+    if (this == &other)
+        return *this;
+    const std::uint8_t state = other.__state.load(std::memory_order_acquire) & ALL;
+    if (state & RMAT)
+        __rmat = other.__rmat;
+    if (state & RVEC)
+        __rvec = other.__rvec;
+    if (state & QUAT)
+        __quat = other.__quat;
+    __tvec = other.__tvec;
+    __mode = other.__mode;
+    __state.store(state, std::memory_order_relaxed);
+    return *this;
 }
 
 // 使用旋转矩阵和平移向量构造
 template <transform6D_concepts::rmat_type T, transform6D_concepts::tvec_type U>
-inline Transform6D::Transform6D(const T &rmat, const U &tvec)
+inline Transform6D::Transform6D(const T &rmat, const U &tvec, InitMode mode)
     : __rmat(transform6D_utils::convertRmat(rmat)),
       __tvec(transform6D_utils::convertTvec(tvec)),
-      __rmat_initialized(true),
-      __rvec_initialized(false)
+      __state(RMAT),
+      __mode(mode)
 {
-    // 旋转矩阵已初始化，旋转向量未初始化
+    // 旋转矩阵已初始化，旋转向量与四元数未初始化
+    if (__mode == InitMode::Eager)
+        ensureInitialized(ALL);
 }
 
 // 使用旋转向量和平移向量构造
 template <transform6D_concepts::rvec_type T, transform6D_concepts::tvec_type U>
-inline Transform6D::Transform6D(const T &rvec, const U &tvec)
+inline Transform6D::Transform6D(const T &rvec, const U &tvec, InitMode mode)
     : __rvec(transform6D_utils::convertRvec(rvec)),
       __tvec(transform6D_utils::convertTvec(tvec)),
-      __rvec_initialized(true),
-      __rmat_initialized(false)
+      __state(RVEC),
+      __mode(mode)
+{
+    // 旋转向量已初始化，旋转矩阵与四元数未初始化
+    if (__mode == InitMode::Eager)
+        ensureInitialized(ALL);
+}
+
+// 使用四元数和平移向量构造
+template <transform6D_concepts::quat_type T, transform6D_concepts::tvec_type U>
+inline Transform6D::Transform6D(const T &quat, const U &tvec, InitMode mode)
+    : __quat(transform6D_utils::convertQuat(quat)),
+      __tvec(transform6D_utils::convertTvec(tvec)),
+      __state(QUAT),
+      __mode(mode)
 {
-    // 旋转向量已初始化，旋转矩阵未初始化
+    // 四元数已初始化，旋转矩阵与旋转向量未初始化
+    if (__mode == InitMode::Eager)
+        ensureInitialized(ALL);
 }
 
-// 确保旋转矩阵有效
-inline void Transform6D::ensureRmatInitialized() const
+inline void Transform6D::initMode(InitMode mode) noexcept
 {
-    if (!__rmat_initialized)
+    __mode = mode;
+    if (__mode == InitMode::Eager)
+        ensureInitialized(ALL);
+}
+
+// 由已有形式计算指定形式
+inline std::uint8_t Transform6D::computeForm(std::uint8_t flag, std::uint8_t state) const noexcept
+{
+    std::uint8_t added = 0;
+    // 四元数作为中间形式：旋转矩阵与旋转向量之间的转换均经由四元数
+    if ((flag & ~state) && !(state & QUAT))
     {
-        if (__rvec_initialized)
-        {
-            // 从旋转向量计算旋转矩阵
-            cv::Rodrigues(__rvec, __rmat);
-        }
+        if (state & RVEC)
+            __quat = transform6D_utils::rvecToQuat(__rvec);
+        else if (state & RMAT)
+            __quat = transform6D_utils::rmatToQuat(__rmat);
         else
-        {
-            // 默认单位矩阵
-            __rmat = RmatType::eye();
-        }
-        __rmat_initialized = true;
+            __quat = QuatType(1, 0, 0, 0); // 默认单位四元数
+        added |= QUAT;
+    }
+    if ((flag & RMAT) && !(state & RMAT))
+    {
+        __rmat = transform6D_utils::quatToRmat(__quat);
+        added |= RMAT;
     }
+    if ((flag & RVEC) && !(state & RVEC))
+    {
+        __rvec = transform6D_utils::quatToRvec(__quat);
+        added |= RVEC;
+    }
+    return added;
 }
 
-// 确保旋转向量有效
-inline void Transform6D::ensureRvecInitialized() const
+// 确保指定形式有效
+inline void Transform6D::ensureInitialized(std::uint8_t flag) const noexcept
 {
-    if (!__rvec_initialized)
+    std::uint8_t state = __state.load(std::memory_order_acquire);
+    if ((state & flag) == flag)
+        return;
+    if (__mode != InitMode::Atomic)
     {
-        if (__rmat_initialized)
-        {
-            // 从旋转矩阵计算旋转向量
-            cv::Rodrigues(__rmat, __rvec);
-        }
-        else
-        {
-            // 默认零向量
-            __rvec = RvecType::zeros();
-        }
-        __rvec_initialized = true;
+        __state.store(state | computeForm(flag, state), std::memory_order_relaxed);
+        return;
+    }
+
+    // Atomic 模式：获得 BUSY 标记的线程负责计算，其余线程等待其发布结果
+    while (true)
+    {
+        if ((state & flag) == flag)
+            return;
+        if (!(state & BUSY) &&
+            __state.compare_exchange_weak(state, state | BUSY, std::memory_order_acquire, std::memory_order_relaxed))
+            break;
+        std::this_thread::yield();
+        state = __state.load(std::memory_order_acquire);
     }
+    const std::uint8_t added = computeForm(flag, state);
+    __state.store(state | added, std::memory_order_release);
+}
+
+inline void Transform6D::resetState(std::uint8_t flag) noexcept
+{
+    __state.store(flag, std::memory_order_relaxed);
+    if (__mode == InitMode::Eager)
+        ensureInitialized(ALL);
 }
 
 inline const Transform6D::RmatType &Transform6D::rmat() const noexcept
 {
-    ensureRmatInitialized();
+    ensureInitialized(RMAT);
     return __rmat;
 }
 
@@ -259,24 +497,28 @@ inline const Transform6D::TvecType &Transform6D::tvec() const noexcept
 
 inline const Transform6D::RvecType &Transform6D::rvec() const noexcept
 {
-    ensureRvecInitialized();
+    ensureInitialized(RVEC);
     return __rvec;
 }
 
+inline const Transform6D::QuatType &Transform6D::quat() const noexcept
+{
+    ensureInitialized(QUAT);
+    return __quat;
+}
+
 template <transform6D_concepts::rmat_type T>
 inline void Transform6D::rmat(const T &rmat) noexcept
 {
     __rmat = transform6D_utils::convertRmat(rmat);
-    __rmat_initialized = true;
-    __rvec_initialized = false; // 旋转向量未初始化
+    resetState(RMAT); // 旋转向量与四元数失效
 }
 
 template <transform6D_concepts::rvec_type T>
 inline void Transform6D::rvec(const T &rvec) noexcept
 {
     __rvec = transform6D_utils::convertRvec(rvec);
-    __rvec_initialized = true;
-    __rmat_initialized = false; // 旋转矩阵未初始化
+    resetState(RVEC); // 旋转矩阵与四元数失效
 }
 
 template <transform6D_concepts::tvec_type T>
@@ -285,6 +527,42 @@ inline void Transform6D::tvec(const T &tvec) noexcept
     __tvec = transform6D_utils::convertTvec(tvec);
 }
 
+template <transform6D_concepts::quat_type T>
+inline void Transform6D::quat(const T &quat) noexcept
+{
+    __quat = transform6D_utils::convertQuat(quat);
+    resetState(QUAT); // 旋转矩阵与旋转向量失效
+}
+
+inline Transform6D Transform6D::compose(const Transform6D &A_to_B, const Transform6D &B_to_C)
+{
+    // 结果沿用 A_to_B 的初始化模式
+    if (A_to_B.hasForm(RMAT) && B_to_C.hasForm(RMAT))
+    {
+        // 两者均已缓存旋转矩阵，直接使用矩阵运算
+        const RmatType new_rmat = A_to_B.__rmat * B_to_C.__rmat;
+        const TvecType new_tvec = A_to_B.__rmat * B_to_C.__tvec + A_to_B.__tvec;
+        return Transform6D(new_rmat, new_tvec, A_to_B.__mode);
+    }
+    const QuatType &q_ab = A_to_B.quat();
+    const QuatType new_quat = transform6D_utils::quatMul(q_ab, B_to_C.quat());
+    const TvecType new_tvec = transform6D_utils::quatRotate(q_ab, B_to_C.__tvec) + A_to_B.__tvec;
+    return Transform6D(new_quat, new_tvec, A_to_B.__mode);
+}
+
+inline Transform6D Transform6D::inverse() const
+{
+    if (hasForm(RMAT))
+    {
+        const RmatType inv_rmat = __rmat.t();
+        const TvecType inv_tvec = -(inv_rmat * __tvec);
+        return Transform6D(inv_rmat, inv_tvec, __mode);
+    }
+    const QuatType inv_quat = transform6D_utils::quatConj(quat());
+    const TvecType inv_tvec = -transform6D_utils::quatRotate(inv_quat, __tvec);
+    return Transform6D(inv_quat, inv_tvec, __mode);
+}
+
 /**
  * @brief Transform6D 加法操作
  * @param A_to_B A到B的变换
@@ -293,11 +571,7 @@ inline void Transform6D::tvec(const T &tvec) noexcept
  */
 inline Transform6D operator+(const Transform6D &A_to_B, const Transform6D &B_to_C)
 {
-    // 计算新的旋转矩阵和平移向量
-    const Transform6D::RmatType new_rmat = A_to_B.rmat() * B_to_C.rmat();
-    const Transform6D::TvecType new_tvec = A_to_B.rmat() * B_to_C.tvec() + A_to_B.tvec();
-
-    return Transform6D(new_rmat, new_tvec);
+    return Transform6D::compose(A_to_B, B_to_C);
 }
 
 /**
@@ -308,13 +582,7 @@ inline Transform6D operator+(const Transform6D &A_to_B, const Transform6D &B_to_
  */
 inline Transform6D operator-(const Transform6D &A_to_C, const Transform6D &B_to_C)
 {
-    const auto C_to_B_rmat = B_to_C.rmat().t();            // B到C的逆变换
-    const auto C_to_B_tvec = -C_to_B_rmat * B_to_C.tvec(); // B到C的逆平移向量
-    // 计算新的旋转矩阵和平移向量
-    const Transform6D::RmatType new_rmat = A_to_C.rmat() * C_to_B_rmat;
-    const Transform6D::TvecType new_tvec = A_to_C.rmat() * C_to_B_tvec + A_to_C.tvec();
-
-    return Transform6D(new_rmat, new_tvec);
+    return Transform6D::compose(A_to_C, B_to_C.inverse());
 }
 
 /**
@@ -325,12 +593,7 @@ inline Transform6D operator-(const Transform6D &A_to_C, const Transform6D &B_to_
  */
 inline Transform6D &operator+=(Transform6D &A_to_B, const Transform6D &B_to_C)
 {
-    // 计算新的旋转矩阵和平移向量
-    const Transform6D::RmatType new_rmat = A_to_B.rmat() * B_to_C.rmat();
-    const Transform6D::TvecType new_tvec = A_to_B.rmat() * B_to_C.tvec() + A_to_B.tvec();
-
-    A_to_B.rmat(new_rmat);
-    A_to_B.tvec(new_tvec);
+    A_to_B = Transform6D::compose(A_to_B, B_to_C);
     return A_to_B;
 }
 
@@ -342,14 +605,7 @@ inline Transform6D &operator+=(Transform6D &A_to_B, const Transform6D &B_to_C)
  */
 inline Transform6D &operator-=(Transform6D &A_to_C, const Transform6D &B_to_C)
 {
-    // 计算新的旋转矩阵和平移向量
-    const auto C_to_B_rmat = B_to_C.rmat().t();            // B到C的逆变换
-    const auto C_to_B_tvec = -C_to_B_rmat * B_to_C.tvec(); // B到C的逆平移向量
-    const Transform6D::RmatType new_rmat = A_to_C.rmat() * C_to_B_rmat;
-    const Transform6D::TvecType new_tvec = A_to_C.rmat() * C_to_B_tvec + A_to_C.tvec();
-    A_to_C.rmat(new_rmat);
-    A_to_C.tvec(new_tvec);
-
+    A_to_C = Transform6D::compose(A_to_C, B_to_C.inverse());
     return A_to_C;
 }
 
@@ -374,11 +630,130 @@ namespace transform6D_utils
         return geom_utils_concepts::convert3d<Transform6D::TvecType>(tvec);
     }
 
+    template <transform6D_concepts::quat_type T>
+    inline Transform6D::QuatType convertQuat(const T &quat)
+    {
+        Transform6D::QuatType q = static_cast<Transform6D::QuatType>(quat);
+        const double norm = std::sqrt(q.dot(q));
+        return norm > 0 ? q * (1.0 / norm) : Transform6D::QuatType(1, 0, 0, 0);
+    }
+
     inline Transform6D::RmatType convertRmat(const cv::Matx<Transform6D::RvecType::value_type, 3, 1> &rvec)
     {
-        auto rmat = Transform6D::RmatType::eye();
-        cv::Rodrigues(rvec, rmat);
-        return rmat;
+        return quatToRmat(rvecToQuat(Transform6D::RvecType(rvec(0), rvec(1), rvec(2))));
+    }
+
+    // ---------------【旋转表示的闭式转换实现】----------------
+    inline Transform6D::QuatType rvecToQuat(const Transform6D::RvecType &rvec) noexcept
+    {
+        const double theta_sq = rvec.dot(rvec);
+        const double theta = std::sqrt(theta_sq);
+        // sin(θ/2)/θ，小角度时使用泰勒展开避免除零
+        const double scale = theta > 1e-8 ? std::sin(0.5 * theta) / theta : 0.5 - theta_sq / 48.0;
+        return Transform6D::QuatType(std::cos(0.5 * theta), rvec(0) * scale, rvec(1) * scale, rvec(2) * scale);
+    }
+
+    inline Transform6D::RvecType quatToRvec(const Transform6D::QuatType &quat) noexcept
+    {
+        // 取 w >= 0 的等价四元数，使旋转角落在 [0, π]
+        const double sign = quat(0) < 0 ? -1.0 : 1.0;
+        const double w = sign * quat(0);
+        const double x = sign * quat(1), y = sign * quat(2), z = sign * quat(3);
+        const double sin_half = std::sqrt(x * x + y * y + z * z);
+        // θ/sin(θ/2)，小角度时 θ ≈ 2·sin(θ/2)/w
+        const double scale = sin_half > 1e-12 ? 2.0 * std::atan2(sin_half, w) / sin_half : 2.0 / w;
+        return Transform6D::RvecType(x * scale, y * scale, z * scale);
+    }
+
+    inline Transform6D::RmatType quatToRmat(const Transform6D::QuatType &quat) noexcept
+    {
+        const double w = quat(0), x = quat(1), y = quat(2), z = quat(3);
+        const double xx = x * x, yy = y * y, zz = z * z;
+        const double xy = x * y, xz = x * z, yz = y * z;
+        const double wx = w * x, wy = w * y, wz = w * z;
+        return Transform6D::RmatType(1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy),
+                                     2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx),
+                                     2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy));
+    }
+
+    inline Transform6D::QuatType rmatToQuat(const Transform6D::RmatType &r) noexcept
+    {
+        // Shepperd 方法：选取最大的对角组合开方，保证数值稳定
+        const double trace = r(0, 0) + r(1, 1) + r(2, 2);
+        Transform6D::QuatType q;
+        if (trace > 0)
+        {
+            const double s = 2.0 * std::sqrt(trace + 1.0);
+            q = Transform6D::QuatType(0.25 * s, (r(2, 1) - r(1, 2)) / s, (r(0, 2) - r(2, 0)) / s, (r(1, 0) - r(0, 1)) / s);
+        }
+        else if (r(0, 0) > r(1, 1) && r(0, 0) > r(2, 2))
+        {
+            const double s = 2.0 * std::sqrt(1.0 + r(0, 0) - r(1, 1) - r(2, 2));
+            q = Transform6D::QuatType((r(2, 1) - r(1, 2)) / s, 0.25 * s, (r(0, 1) + r(1, 0)) / s, (r(0, 2) + r(2, 0)) / s);
+        }
+        else if (r(1, 1) > r(2, 2))
+        {
+            const double s = 2.0 * std::sqrt(1.0 + r(1, 1) - r(0, 0) - r(2, 2));
+            q = Transform6D::QuatType((r(0, 2) - r(2, 0)) / s, (r(0, 1) + r(1, 0)) / s, 0.25 * s, (r(1, 2) + r(2, 1)) / s);
+        }
+        else
+        {
+            const double s = 2.0 * std::sqrt(1.0 + r(2, 2) - r(0, 0) - r(1, 1));
+            q = Transform6D::QuatType((r(1, 0) - r(0, 1)) / s, (r(0, 2) + r(2, 0)) / s, (r(1, 2) + r(2, 1)) / s, 0.25 * s);
+        }
+        return q;
+    }
+
+    inline Transform6D::QuatType quatMul(const Transform6D::QuatType &a, const Transform6D::QuatType &b) noexcept
+    {
+        Transform6D::QuatType q(a(0) * b(0) - a(1) * b(1) - a(2) * b(2) - a(3) * b(3),
+                                a(0) * b(1) + a(1) * b(0) + a(2) * b(3) - a(3) * b(2),
+                                a(0) * b(2) - a(1) * b(3) + a(2) * b(0) + a(3) * b(1),
+                                a(0) * b(3) + a(1) * b(2) - a(2) * b(1) + a(3) * b(0));
+        // 重新归一化，抑制长链复合的数值漂移
+        const double norm_sq = q.dot(q);
+        return std::abs(norm_sq - 1.0) > 1e-12 ? q * (1.0 / std::sqrt(norm_sq)) : q;
+    }
+
+    inline Transform6D::TvecType quatRotate(const Transform6D::QuatType &quat, const Transform6D::TvecType &v) noexcept
+    {
+        // v' = v + w·t + q_v × t，其中 t = 2·(q_v × v)
+        const double w = quat(0), x = quat(1), y = quat(2), z = quat(3);
+        const double tx = 2 * (y * v(2) - z * v(1));
+        const double ty = 2 * (z * v(0) - x * v(2));
+        const double tz = 2 * (x * v(1) - y * v(0));
+        return Transform6D::TvecType(v(0) + w * tx + (y * tz - z * ty),
+                                     v(1) + w * ty + (z * tx - x * tz),
+                                     v(2) + w * tz + (x * ty - y * tx));
+    }
+
+    inline Transform6D::QuatType quatConj(const Transform6D::QuatType &quat) noexcept
+    {
+        return Transform6D::QuatType(quat(0), -quat(1), -quat(2), -quat(3));
+    }
+
+    inline Transform6D::QuatType slerp(const Transform6D::QuatType &q0, const Transform6D::QuatType &q1, double t) noexcept
+    {
+        double cos_theta = q0.dot(q1);
+        // q 与 -q 表示同一旋转，取最短弧
+        const double sign = cos_theta < 0 ? -1.0 : 1.0;
+        cos_theta *= sign;
+        double w0 = 1.0 - t, w1 = t;
+        if (cos_theta < 0.9995)
+        {
+            const double theta = std::acos(cos_theta);
+            const double inv_sin = 1.0 / std::sin(theta);
+            w0 = std::sin((1.0 - t) * theta) * inv_sin;
+            w1 = std::sin(t * theta) * inv_sin;
+        }
+        // 夹角很小时退化为归一化线性插值
+        Transform6D::QuatType q = q0 * w0 + q1 * (sign * w1);
+        return q * (1.0 / std::sqrt(q.dot(q)));
+    }
+
+    inline Transform6D interpolate(const Transform6D &T0, const Transform6D &T1, double t)
+    {
+        return Transform6D(slerp(T0.quat(), T1.quat(), t), T0.tvec() * (1.0 - t) + T1.tvec() * t, T0.initMode());
     }
 }
 
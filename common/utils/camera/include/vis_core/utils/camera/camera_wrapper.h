@@ -2,18 +2,39 @@
 
 
 #include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
 
 #include "vis_core/core/type_utils/cv_expansion_type.h"
+#include "vis_core/math/pose_proc/transform6D.hpp"
 
 
 /**
  * @brief 相机包装类
+ *
+ * @note - 相机参数在构造后不再改变，去畸变映射表与逆畸变查找网格在首次使用时构建，且每个相机只构建一次
+ *
+ *       - 构建过程使用 std::call_once，可被多个线程同时触发
  */
 class CameraWrapper
 {
 public:
     using Ptr = std::shared_ptr<CameraWrapper>; //!< 智能指针类型
+
+    /**
+     * @brief 图像去畸变映射表 (用于 cv::remap)
+     */
+    struct UndistortMaps
+    {
+        cv::Mat map1; //!< 定点坐标映射 (CV_16SC2)
+        cv::Mat map2; //!< 插值系数表 (CV_16UC1)
+    };
+
+    static constexpr int GRID_STEP = 8; //!< 逆畸变查找网格的间距 (像素)
+
     CameraWrapper() = default;
     virtual ~CameraWrapper() = default;
 
@@ -22,21 +43,163 @@ public:
      * 
      * @param camera_matrix 相机内参矩阵
      * @param dist_coeffs 相机畸变系数
+     * @param image_size 图像尺寸，为空时无法构建去畸变映射表与逆畸变查找网格
      */
-    static auto create(const cv::Matx33f &camera_matrix = cv::Matx33f::eye(), const cv::Matx51f &dist_coeffs = cv::Matx51f::zeros()) -> Ptr
+    static auto create(const cv::Matx33f &camera_matrix = cv::Matx33f::eye(), const cv::Matx51f &dist_coeffs = cv::Matx51f::zeros(),
+                       const cv::Size &image_size = cv::Size()) -> Ptr
     {
         auto instance = std::make_shared<CameraWrapper>();
         instance->camera_matrix = camera_matrix;
         instance->dist_coeffs = dist_coeffs;
+        instance->image_size = image_size;
         return instance;
     }
 
+    /**
+     * @brief 获取相机内参矩阵
+     */
+    const cv::Matx33f &cameraMatrix() const noexcept { return camera_matrix; }
+
+    /**
+     * @brief 获取相机畸变系数 (k1, k2, p1, p2, k3)
+     */
+    const cv::Matx51f &distCoeffs() const noexcept { return dist_coeffs; }
+
+    /**
+     * @brief 获取图像尺寸
+     */
+    const cv::Size &imageSize() const noexcept { return image_size; }
+
+    /**
+     * @brief 是否存在畸变
+     */
+    bool hasDistortion() const noexcept
+    {
+        return dist_coeffs(0) != 0 || dist_coeffs(1) != 0 || dist_coeffs(2) != 0 || dist_coeffs(3) != 0 || dist_coeffs(4) != 0;
+    }
+
+    /**
+     * @brief 将像素坐标去畸变并转换为归一化相机坐标
+     *
+     * @param pixel 像素坐标 (含畸变)
+     * @param iterations 迭代次数
+     * @return 归一化相机坐标 (x/z, y/z)
+     *
+     * @note 与 cv::undistortPoints 的迭代方式一致，但只处理单个点且不分配内存
+     */
+    cv::Point2d undistortNormalized(const cv::Point2d &pixel, int iterations = 5) const noexcept
+    {
+        const double fx = camera_matrix(0, 0), fy = camera_matrix(1, 1);
+        const double cx = camera_matrix(0, 2), cy = camera_matrix(1, 2);
+        const double x0 = (pixel.x - cx) / fx, y0 = (pixel.y - cy) / fy;
+        if (!hasDistortion())
+            return {x0, y0};
+        const double k1 = dist_coeffs(0), k2 = dist_coeffs(1), p1 = dist_coeffs(2), p2 = dist_coeffs(3), k3 = dist_coeffs(4);
+
+        double x = x0, y = y0;
+        for (int i = 0; i < iterations; ++i)
+        {
+            const double r2 = x * x + y * y;
+            const double inv_radial = 1.0 / (1 + ((k3 * r2 + k2) * r2 + k1) * r2);
+            const double delta_x = 2 * p1 * x * y + p2 * (r2 + 2 * x * x);
+            const double delta_y = p1 * (r2 + 2 * y * y) + 2 * p2 * x * y;
+            x = (x0 - delta_x) * inv_radial;
+            y = (y0 - delta_y) * inv_radial;
+        }
+        return {x, y};
+    }
+
+    /**
+     * @brief 查表将像素坐标去畸变并转换为归一化相机坐标
+     *
+     * @param pixel 像素坐标 (含畸变)
+     * @return 归一化相机坐标 (x/z, y/z)
+     *
+     * @note - 在逆畸变查找网格上双线性插值，网格在首次调用时构建
+     *
+     *       - 无畸变时直接换算；图像尺寸未知或点位于图像外时回退到 undistortNormalized
+     */
+    cv::Point2d lookupNormalized(const cv::Point2d &pixel) const
+    {
+        if (!hasDistortion() || image_size.empty())
+            return undistortNormalized(pixel);
+        std::call_once(__grid_once, [this]
+                       { buildUndistortGrid(); });
+
+        const double gx = pixel.x * (1.0 / GRID_STEP), gy = pixel.y * (1.0 / GRID_STEP);
+        if (!(gx >= 0 && gy >= 0 && gx < __grid_cols - 1 && gy < __grid_rows - 1))
+            return undistortNormalized(pixel);
+        const int ix = static_cast<int>(gx), iy = static_cast<int>(gy);
+        const double ax = gx - ix, ay = gy - iy;
+        const cv::Point2f *row0 = __grid.data() + static_cast<std::size_t>(iy) * __grid_cols + ix;
+        const cv::Point2f *row1 = row0 + __grid_cols;
+        const double w00 = (1 - ax) * (1 - ay), w01 = ax * (1 - ay), w10 = (1 - ax) * ay, w11 = ax * ay;
+        return {w00 * row0[0].x + w01 * row0[1].x + w10 * row1[0].x + w11 * row1[1].x,
+                w00 * row0[0].y + w01 * row0[1].y + w10 * row1[0].y + w11 * row1[1].y};
+    }
+
+    /**
+     * @brief 批量查表去畸变
+     *
+     * @param pixels 像素坐标 (含畸变)
+     * @param normalized 归一化相机坐标，数量须与 pixels 一致
+     */
+    void lookupNormalized(const std::vector<cv::Point2f> &pixels, std::vector<cv::Point2d> &normalized) const;
+
+    /**
+     * @brief 批量将三维点投影到像素平面
+     *
+     * @param points 三维点 (位于特征坐标系)
+     * @param camera_to_feature 特征在相机坐标系下的位姿
+     * @param pixels 像素坐标，数量须与 points 一致
+     *
+     * @note - 投影模型为针孔模型与 5 参数 Brown-Conrady 畸变，与 cv::projectPoints 一致，但不计算雅可比矩阵、不分配内存
+     *
+     *       - 使用 OpenCV 通用 SIMD 指令每次处理两个点，无畸变时跳过畸变多项式
+     */
+    void project(std::span<const cv::Point3d> points, const Transform6D &camera_to_feature, std::span<cv::Point2d> pixels) const;
+
+    /**
+     * @brief 批量将三维点投影到像素平面 (单精度)
+     *
+     * @note 内部以双精度分块计算，参见 project(std::span<const cv::Point3d>, const Transform6D &, std::span<cv::Point2d>)
+     */
+    void project(std::span<const cv::Point3f> points, const Transform6D &camera_to_feature, std::span<cv::Point2f> pixels) const;
+
+    /**
+     * @brief 获取图像去畸变映射表
+     *
+     * @note 首次调用时由 cv::initUndistortRectifyMap 构建，去畸变后的图像沿用原相机内参
+     */
+    const UndistortMaps &undistortMaps() const;
+
+    /**
+     * @brief 对整幅图像去畸变
+     *
+     * @param src 原图像，尺寸须与相机图像尺寸一致
+     * @param dst 去畸变后的图像
+     * @param interpolation 插值方式
+     */
+    void undistortImage(const cv::Mat &src, cv::Mat &dst, int interpolation = cv::INTER_LINEAR) const;
+
+private:
+    //! 构建逆畸变查找网格
+    void buildUndistortGrid() const;
+
 private:
     //! 相机内参矩阵
     cv::Matx33f camera_matrix = cv::Matx33f::eye(); //!< 相机内参矩阵
     //! 相机畸变系数
     cv::Matx51f dist_coeffs = cv::Matx51f::zeros(); //!< 相机畸变系数
+    //! 图像尺寸
+    cv::Size image_size; //!< 图像尺寸
 
+    mutable std::once_flag __maps_once;       //!< 去畸变映射表构建标志
+    mutable UndistortMaps __maps;             //!< 去畸变映射表
+    mutable std::once_flag __grid_once;       //!< 逆畸变查找网格构建标志
+    mutable std::vector<cv::Point2f> __grid;  //!< 逆畸变查找网格 (行优先，元素为归一化坐标)
+    mutable int __grid_cols = 0;              //!< 网格列数
+    mutable int __grid_rows = 0;              //!< 网格行数
 };
 
 using CameraWrapper_ptr = std::shared_ptr<CameraWrapper>; //!< 相机包装类智能指针类型
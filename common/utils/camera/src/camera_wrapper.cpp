@@ -0,0 +1,169 @@
+#include "vis_core/utils/camera/camera_wrapper.h"
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+
+#include "vis_core/core/logging/logging.h"
+#include "vis_core/math/pose_proc/batch_transform.hpp"
+
+using namespace std;
+using namespace cv;
+
+namespace
+{
+    //! 投影所需的相机参数
+    struct Intrinsics
+    {
+        double fx, fy, cx, cy;     //!< 焦距与主点
+        double k1, k2, p1, p2, k3; //!< 畸变系数
+    };
+
+    //! 单点投影
+    template <bool DISTORTED>
+    inline void projectOne(const Matx34d &m, const Intrinsics &k, const double *p, double *q) noexcept
+    {
+        const double X = m(0, 0) * p[0] + m(0, 1) * p[1] + m(0, 2) * p[2] + m(0, 3);
+        const double Y = m(1, 0) * p[0] + m(1, 1) * p[1] + m(1, 2) * p[2] + m(1, 3);
+        const double Z = m(2, 0) * p[0] + m(2, 1) * p[1] + m(2, 2) * p[2] + m(2, 3);
+        const double inv_z = 1.0 / Z;
+        double x = X * inv_z, y = Y * inv_z;
+        if constexpr (DISTORTED)
+        {
+            const double xx = x * x, yy = y * y, xy = x * y, r2 = xx + yy;
+            const double radial = 1 + r2 * (k.k1 + r2 * (k.k2 + r2 * k.k3));
+            const double xd = x * radial + 2 * k.p1 * xy + k.p2 * (r2 + 2 * xx);
+            const double yd = y * radial + k.p1 * (r2 + 2 * yy) + 2 * k.p2 * xy;
+            x = xd;
+            y = yd;
+        }
+        q[0] = k.fx * x + k.cx;
+        q[1] = k.fy * y + k.cy;
+    }
+
+    /**
+     * @brief 批量投影 (输入 xyzxyz...，输出 uvuv...)
+     *
+     * @tparam DISTORTED 是否计算畸变
+     */
+    template <bool DISTORTED>
+    void projectKernel(const Matx34d &m, const Intrinsics &k, const double *src, double *dst, size_t count) noexcept
+    {
+        size_t i = 0;
+#if CV_SIMD128_64F
+        const v_float64x2 m00 = v_setall_f64(m(0, 0)), m01 = v_setall_f64(m(0, 1)), m02 = v_setall_f64(m(0, 2)), m03 = v_setall_f64(m(0, 3));
+        const v_float64x2 m10 = v_setall_f64(m(1, 0)), m11 = v_setall_f64(m(1, 1)), m12 = v_setall_f64(m(1, 2)), m13 = v_setall_f64(m(1, 3));
+        const v_float64x2 m20 = v_setall_f64(m(2, 0)), m21 = v_setall_f64(m(2, 1)), m22 = v_setall_f64(m(2, 2)), m23 = v_setall_f64(m(2, 3));
+        const v_float64x2 fx = v_setall_f64(k.fx), fy = v_setall_f64(k.fy), cx = v_setall_f64(k.cx), cy = v_setall_f64(k.cy);
+        const v_float64x2 one = v_setall_f64(1), two = v_setall_f64(2);
+        const v_float64x2 k1 = v_setall_f64(k.k1), k2 = v_setall_f64(k.k2), k3 = v_setall_f64(k.k3);
+        const v_float64x2 p1_2 = v_setall_f64(2 * k.p1), p2_2 = v_setall_f64(2 * k.p2);
+        const v_float64x2 p1 = v_setall_f64(k.p1), p2 = v_setall_f64(k.p2);
+        for (; i + 2 <= count; i += 2)
+        {
+            v_float64x2 px, py, pz;
+            v_load_deinterleave(src + 3 * i, px, py, pz);
+            const v_float64x2 X = v_fma(m00, px, v_fma(m01, py, v_fma(m02, pz, m03)));
+            const v_float64x2 Y = v_fma(m10, px, v_fma(m11, py, v_fma(m12, pz, m13)));
+            const v_float64x2 Z = v_fma(m20, px, v_fma(m21, py, v_fma(m22, pz, m23)));
+            const v_float64x2 inv_z = one / Z;
+            v_float64x2 x = X * inv_z, y = Y * inv_z;
+            if constexpr (DISTORTED)
+            {
+                const v_float64x2 xx = x * x, yy = y * y, xy = x * y;
+                const v_float64x2 r2 = xx + yy;
+                const v_float64x2 radial = v_fma(r2, v_fma(r2, v_fma(r2, k3, k2), k1), one);
+                // xd = x * radial + 2 p1 xy + p2 (r2 + 2 xx)，yd = y * radial + p1 (r2 + 2 yy) + 2 p2 xy
+                const v_float64x2 xd = v_fma(x, radial, v_fma(p1_2, xy, p2 * v_fma(two, xx, r2)));
+                const v_float64x2 yd = v_fma(y, radial, v_fma(p2_2, xy, p1 * v_fma(two, yy, r2)));
+                x = xd;
+                y = yd;
+            }
+            v_store_interleave(dst + 2 * i, v_fma(fx, x, cx), v_fma(fy, y, cy));
+        }
+#endif
+        for (; i < count; ++i)
+            projectOne<DISTORTED>(m, k, src + 3 * i, dst + 2 * i);
+    }
+}
+
+void CameraWrapper::lookupNormalized(const vector<Point2f> &pixels, vector<Point2d> &normalized) const
+{
+    normalized.resize(pixels.size());
+    for (size_t i = 0; i < pixels.size(); ++i)
+        normalized[i] = lookupNormalized(Point2d(pixels[i]));
+}
+
+const CameraWrapper::UndistortMaps &CameraWrapper::undistortMaps() const
+{
+    if (image_size.empty())
+        VISCORE_THROW_ERROR("CameraWrapper : 图像尺寸未知，无法构建去畸变映射表");
+    call_once(__maps_once, [this]
+              { initUndistortRectifyMap(camera_matrix, dist_coeffs, noArray(), camera_matrix, image_size,
+                                        CV_16SC2, __maps.map1, __maps.map2); });
+    return __maps;
+}
+
+void CameraWrapper::undistortImage(const Mat &src, Mat &dst, int interpolation) const
+{
+    if (src.cols != image_size.width || src.rows != image_size.height)
+        VISCORE_THROW_ERROR("CameraWrapper : 图像尺寸 (%d x %d) 与相机图像尺寸 (%d x %d) 不一致",
+                            src.cols, src.rows, image_size.width, image_size.height);
+    if (!hasDistortion())
+    {
+        src.copyTo(dst);
+        return;
+    }
+    const auto &maps = undistortMaps();
+    remap(src, dst, maps.map1, maps.map2, interpolation);
+}
+
+void CameraWrapper::buildUndistortGrid() const
+{
+    // 网格覆盖 [0, width] x [0, height]，多出一行一列保证边缘像素可以插值
+    __grid_cols = (image_size.width + GRID_STEP - 1) / GRID_STEP + 2;
+    __grid_rows = (image_size.height + GRID_STEP - 1) / GRID_STEP + 2;
+    __grid.resize(static_cast<size_t>(__grid_cols) * __grid_rows);
+    for (int r = 0; r < __grid_rows; ++r)
+    {
+        for (int c = 0; c < __grid_cols; ++c)
+        {
+            // 网格节点只计算一次，使用更多迭代次数换取精度
+            const Point2d p = undistortNormalized(Point2d(c * GRID_STEP, r * GRID_STEP), 20);
+            __grid[static_cast<size_t>(r) * __grid_cols + c] = Point2f(static_cast<float>(p.x), static_cast<float>(p.y));
+        }
+    }
+}
+
+void CameraWrapper::project(span<const Point3d> points, const Transform6D &camera_to_feature, span<Point2d> pixels) const
+{
+    if (points.size() != pixels.size())
+        VISCORE_THROW_ERROR("CameraWrapper : 三维点数量 (%zu) 与像素点数量 (%zu) 不一致", points.size(), pixels.size());
+    const Intrinsics k{camera_matrix(0, 0), camera_matrix(1, 1), camera_matrix(0, 2), camera_matrix(1, 2),
+                       dist_coeffs(0), dist_coeffs(1), dist_coeffs(2), dist_coeffs(3), dist_coeffs(4)};
+    const Matx34d m = pose_batch::toAffine(camera_to_feature);
+    const double *src = reinterpret_cast<const double *>(points.data());
+    double *dst = reinterpret_cast<double *>(pixels.data());
+    if (hasDistortion())
+        projectKernel<true>(m, k, src, dst, points.size());
+    else
+        projectKernel<false>(m, k, src, dst, points.size());
+}
+
+void CameraWrapper::project(span<const Point3f> points, const Transform6D &camera_to_feature, span<Point2f> pixels) const
+{
+    if (points.size() != pixels.size())
+        VISCORE_THROW_ERROR("CameraWrapper : 三维点数量 (%zu) 与像素点数量 (%zu) 不一致", points.size(), pixels.size());
+    // 分块转换为双精度，块缓冲区位于栈上
+    constexpr size_t BLOCK = 64;
+    Point3d src[BLOCK];
+    Point2d dst[BLOCK];
+    for (size_t begin = 0; begin < points.size(); begin += BLOCK)
+    {
+        const size_t count = std::min(BLOCK, points.size() - begin);
+        for (size_t i = 0; i < count; ++i)
+            src[i] = Point3d(points[begin + i].x, points[begin + i].y, points[begin + i].z);
+        project(span<const Point3d>(src, count), camera_to_feature, span<Point2d>(dst, count));
+        for (size_t i = 0; i < count; ++i)
+            pixels[begin + i] = Point2f(static_cast<float>(dst[i].x), static_cast<float>(dst[i].y));
+    }
+}
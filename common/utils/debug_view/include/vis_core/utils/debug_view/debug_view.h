@@ -0,0 +1,235 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vis_core/visual/feature_node/draw_buffer.h"
+
+namespace cv
+{
+    class VideoWriter;
+}
+
+/**
+ * @brief 调试可视化输出方式
+ */
+enum class DebugViewOutput
+{
+    Auto,          //!< 存在 DISPLAY / WAYLAND_DISPLAY 环境变量时显示窗口，否则写入图像序列
+    Display,       //!< 显示窗口
+    ImageSequence, //!< 写入图像序列
+    Video,         //!< 写入视频 (每个窗口一个文件)
+    Discard,       //!< 丢弃 (仅消费队列)
+};
+
+/**
+ * @brief 调试可视化输出配置
+ */
+struct DebugViewOptions
+{
+    DebugViewOutput output = DebugViewOutput::Auto; //!< 输出方式
+    std::string output_dir = "debug_view";          //!< 图像序列或视频的输出目录
+    double video_fps = 30.0;                        //!< 视频帧率
+    size_t capacity = 8;                            //!< 队列容量 (向上取整为 2 的幂)
+    size_t max_frames = 1000;                       //!< 图像序列或视频中每个窗口最多写入的帧数 (0 表示不限)
+};
+
+/**
+ * @class DebugViewSink
+ * @brief 异步调试可视化输出
+ *
+ * 1. 识别线程通过 push 投递图像与绘制命令，投递过程不等待消费线程，队列满时丢弃最旧的帧
+ * 2. 独立的消费线程负责叠加绘制命令并输出：有显示环境时显示窗口，无显示环境时默认写入图像序列
+ * 3. 滑动条由消费线程创建与维护，识别线程只读取其原子值，不接触 HighGUI
+ *
+ * @note - 队列并非无锁：每个槽位由自旋标志保护，临界区内只交换帧内容，
+ *         投递端仅在同一槽位正被另一端交换时短暂自旋
+ *
+ *       - 写入图像序列或视频时每个窗口最多写入 max_frames 帧，不需要文件输出时可指定 Discard
+ *
+ *       - push 仅增加 cv::Mat 的引用计数，调用方在投递后不可再原地修改该图像的数据
+ *
+ *       - 所有 HighGUI 调用均在消费线程中完成
+ */
+class DebugViewSink
+{
+public:
+    using Ptr = std::shared_ptr<DebugViewSink>; //!< 智能指针类型
+
+    using Output = DebugViewOutput;   //!< 输出方式
+    using Options = DebugViewOptions; //!< 输出配置
+
+    /**
+     * @class Trackbar
+     * @brief 滑动条，由消费线程更新、识别线程读取
+     */
+    class Trackbar
+    {
+        friend class DebugViewSink;
+
+    public:
+        Trackbar(std::string window, std::string name, int value, int max_value)
+            : __window(std::move(window)), __name(std::move(name)), __max_value(max_value), __value(value) {}
+
+        //! 获取当前值
+        int value() const noexcept { return __value.load(std::memory_order_relaxed); }
+
+    private:
+        std::string __window;            //!< 所在窗口
+        std::string __name;              //!< 名称
+        int __max_value;                 //!< 最大值
+        std::atomic<int> __value;        //!< 当前值
+        bool __created = false;          //!< 是否已在窗口中创建 (仅消费线程访问)
+    };
+    using Trackbar_ptr = std::shared_ptr<const Trackbar>;
+
+private:
+    /**
+     * @brief 调试帧
+     */
+    struct Frame
+    {
+        std::string window;  //!< 窗口名
+        cv::Mat image;       //!< 图像
+        DrawBuffer overlay;  //!< 叠加绘制命令
+        std::uint64_t seq = 0; //!< 投递序号
+        bool full = false;   //!< 槽位是否存有未消费的帧
+    };
+
+    /**
+     * @brief 队列槽位
+     *
+     * @note 槽位的自旋标志仅在交换帧内容期间持有，帧的析构发生在临界区之外
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic_flag busy = ATOMIC_FLAG_INIT; //!< 自旋标志
+        Frame frame;                              //!< 帧内容
+    };
+
+    /**
+     * @brief 窗口布局
+     */
+    struct WindowLayout
+    {
+        std::string window; //!< 窗口名
+        cv::Rect geometry;  //!< 窗口位置与尺寸
+        bool applied = false; //!< 是否已应用 (仅消费线程访问)
+    };
+
+public:
+    /**
+     * @brief 构造函数，启动消费线程
+     *
+     * @param[in] options 输出配置
+     */
+    explicit DebugViewSink(const Options &options = Options());
+
+    /**
+     * @brief 析构函数，停止并等待消费线程
+     */
+    ~DebugViewSink();
+
+    DebugViewSink(const DebugViewSink &) = delete;
+    DebugViewSink &operator=(const DebugViewSink &) = delete;
+
+    /**
+     * @brief 构造接口
+     *
+     * @param[in] options 输出配置
+     */
+    static Ptr create(const Options &options = Options()) { return std::make_shared<DebugViewSink>(options); }
+
+    /**
+     * @brief 获取进程内共享的默认输出 (首次调用时以默认配置创建)
+     */
+    static Ptr instance();
+
+    /**
+     * @brief 投递调试帧 (不等待消费线程)
+     *
+     * @param[in] window 窗口名
+     * @param[in] image 图像 (不拷贝数据)
+     * @param[in] overlay 叠加绘制命令 (由消费线程渲染)
+     *
+     * @return 是否覆盖了尚未消费的旧帧
+     */
+    bool push(const std::string &window, const cv::Mat &image, DrawBuffer overlay = DrawBuffer());
+
+    /**
+     * @brief 添加滑动条
+     *
+     * @param[in] window 所在窗口
+     * @param[in] name 名称
+     * @param[in] value 初始值
+     * @param[in] max_value 最大值
+     *
+     * @return 滑动条，无显示环境时始终保持初始值
+     */
+    Trackbar_ptr addTrackbar(const std::string &window, const std::string &name, int value, int max_value);
+
+    /**
+     * @brief 设置窗口布局，在窗口首次显示时生效
+     *
+     * @param[in] window 窗口名
+     * @param[in] geometry 窗口位置与尺寸
+     */
+    void setWindowLayout(const std::string &window, const cv::Rect &geometry);
+
+    /**
+     * @brief 获取实际使用的输出方式
+     */
+    Output output() const noexcept { return __options.output; }
+
+    /**
+     * @brief 获取被丢弃的帧数量
+     */
+    std::uint64_t dropped() const noexcept { return __dropped.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 停止消费线程 (剩余的帧会被输出后再退出)
+     */
+    void stop();
+
+private:
+    //! 消费线程主循环
+    void consumeLoop();
+
+    //! 取出序号为 seq 的帧，返回 0 表示成功，1 表示该帧已被覆盖，-1 表示该帧尚未写入
+    int tryPop(std::uint64_t seq, Frame &frame);
+
+    //! 输出一帧
+    void present(Frame &frame);
+
+    //! 在消费线程中应用待创建的滑动条与窗口布局
+    void applyGuiRequests();
+
+    //! 在消费线程中确保窗口已创建
+    void ensureWindow(const std::string &window);
+
+private:
+    Options __options;                        //!< 输出配置
+    std::unique_ptr<Slot[]> __slots;          //!< 队列槽位
+    size_t __mask = 0;                        //!< 槽位序号掩码
+    alignas(64) std::atomic<std::uint64_t> __head{0}; //!< 下一个投递序号
+    std::atomic<std::uint64_t> __dropped{0};  //!< 被丢弃的帧数量
+    std::atomic<bool> __running{true};        //!< 消费线程是否运行
+
+    std::mutex __gui_mutex;                               //!< 保护滑动条与窗口布局的注册
+    std::vector<std::shared_ptr<Trackbar>> __trackbars;   //!< 滑动条
+    std::vector<WindowLayout> __layouts;                  //!< 窗口布局
+    std::vector<std::string> __windows;                   //!< 已创建的窗口 (仅消费线程访问)
+    std::unordered_map<std::string, std::uint64_t> __frame_counters;          //!< 各窗口已写入文件的帧数 (仅消费线程访问)
+    std::unordered_map<std::string, std::unique_ptr<cv::VideoWriter>> __writers; //!< 各窗口的视频写入器 (仅消费线程访问)
+
+    std::thread __consumer; //!< 消费线程
+};
+
+using DebugViewSink_ptr = std::shared_ptr<DebugViewSink>; //!< 调试可视化输出智能指针类型
@@ -0,0 +1,291 @@
+#include "vis_core/utils/debug_view/debug_view.h"
+#include "vis_core/core/logging/logging.h"
+
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+
+using namespace std;
+using namespace cv;
+
+/**
+ * @brief 判断当前进程是否存在可用的图形显示环境
+ */
+static bool hasDisplay()
+{
+    auto non_empty = [](const char *name)
+    {
+        const char *value = std::getenv(name);
+        return value != nullptr && value[0] != '\0';
+    };
+    return non_empty("DISPLAY") || non_empty("WAYLAND_DISPLAY");
+}
+
+/**
+ * @brief 向上取整为 2 的幂
+ */
+static size_t roundUpPow2(size_t n)
+{
+    size_t result = 2;
+    while (result < n)
+        result <<= 1;
+    return result;
+}
+
+DebugViewSink::DebugViewSink(const Options &options) : __options(options)
+{
+    const size_t capacity = roundUpPow2(__options.capacity);
+    __slots = make_unique<Slot[]>(capacity);
+    __mask = capacity - 1;
+
+    // 无显示环境时写入图像序列，写入帧数由 max_frames 限制
+    if (__options.output == Output::Auto)
+        __options.output = hasDisplay() ? Output::Display : Output::ImageSequence;
+
+    if (__options.output == Output::ImageSequence || __options.output == Output::Video)
+    {
+        error_code ec;
+        filesystem::create_directories(__options.output_dir, ec);
+        if (ec)
+        {
+            VISCORE_WARNING_INFO("DebugViewSink : 无法创建输出目录 \"%s\" (%s)，调试帧将被丢弃",
+                                 __options.output_dir.c_str(), ec.message().c_str());
+            __options.output = Output::Discard;
+        }
+    }
+
+    __consumer = thread(&DebugViewSink::consumeLoop, this);
+}
+
+DebugViewSink::~DebugViewSink()
+{
+    stop();
+}
+
+DebugViewSink::Ptr DebugViewSink::instance()
+{
+    static Ptr sink = create();
+    return sink;
+}
+
+void DebugViewSink::stop()
+{
+    __running.store(false, memory_order_release);
+    if (__consumer.joinable())
+        __consumer.join();
+}
+
+bool DebugViewSink::push(const string &window, const Mat &image, DrawBuffer overlay)
+{
+    const uint64_t seq = __head.fetch_add(1, memory_order_acq_rel);
+    Frame incoming{window, image, std::move(overlay), seq, true};
+
+    Slot &slot = __slots[seq & __mask];
+    while (slot.busy.test_and_set(memory_order_acquire))
+        this_thread::yield();
+    bool dropped = false;
+    if (slot.frame.full && slot.frame.seq > seq)
+    {
+        // 更新的帧已先一步写入该槽位，丢弃当前帧
+        dropped = true;
+    }
+    else
+    {
+        dropped = slot.frame.full;
+        swap(slot.frame, incoming);
+    }
+    slot.busy.clear(memory_order_release);
+
+    // 被替换出的旧帧在临界区外析构
+    if (dropped)
+        __dropped.fetch_add(1, memory_order_relaxed);
+    return dropped;
+}
+
+int DebugViewSink::tryPop(uint64_t seq, Frame &frame)
+{
+    Slot &slot = __slots[seq & __mask];
+    while (slot.busy.test_and_set(memory_order_acquire))
+        this_thread::yield();
+    int result = -1;
+    if (slot.frame.seq > seq)
+    {
+        result = 1;
+    }
+    else if (slot.frame.full && slot.frame.seq == seq)
+    {
+        swap(slot.frame, frame);
+        slot.frame.full = false;
+        result = 0;
+    }
+    slot.busy.clear(memory_order_release);
+    return result;
+}
+
+DebugViewSink::Trackbar_ptr DebugViewSink::addTrackbar(const string &window, const string &name, int value, int max_value)
+{
+    auto trackbar = make_shared<Trackbar>(window, name, std::clamp(value, 0, max_value), max_value);
+    lock_guard<mutex> lock(__gui_mutex);
+    __trackbars.push_back(trackbar);
+    return trackbar;
+}
+
+void DebugViewSink::setWindowLayout(const string &window, const Rect &geometry)
+{
+    lock_guard<mutex> lock(__gui_mutex);
+    __layouts.push_back({window, geometry, false});
+}
+
+void DebugViewSink::ensureWindow(const string &window)
+{
+    if (find(__windows.begin(), __windows.end(), window) != __windows.end())
+        return;
+    namedWindow(window, WINDOW_NORMAL);
+    __windows.push_back(window);
+}
+
+void DebugViewSink::applyGuiRequests()
+{
+    if (__options.output != Output::Display)
+        return;
+
+    lock_guard<mutex> lock(__gui_mutex);
+    for (auto &layout : __layouts)
+    {
+        if (layout.applied)
+            continue;
+        ensureWindow(layout.window);
+        resizeWindow(layout.window, layout.geometry.width, layout.geometry.height);
+        moveWindow(layout.window, layout.geometry.x, layout.geometry.y);
+        layout.applied = true;
+    }
+    for (auto &trackbar : __trackbars)
+    {
+        if (trackbar->__created)
+            continue;
+        ensureWindow(trackbar->__window);
+        auto on_change = [](int pos, void *user_data)
+        {
+            static_cast<Trackbar *>(user_data)->__value.store(pos, memory_order_relaxed);
+        };
+        createTrackbar(trackbar->__name, trackbar->__window, nullptr, trackbar->__max_value, on_change, trackbar.get());
+        setTrackbarPos(trackbar->__name, trackbar->__window, trackbar->value());
+        trackbar->__created = true;
+    }
+}
+
+void DebugViewSink::present(Frame &frame)
+{
+    if (__options.output == Output::Discard || frame.image.empty())
+        return;
+
+    uint64_t index = 0;
+    if (__options.output == Output::ImageSequence || __options.output == Output::Video)
+    {
+        index = __frame_counters[frame.window];
+        if (__options.max_frames != 0 && index >= __options.max_frames)
+        {
+            if (index == __options.max_frames)
+                VISCORE_WARNING_INFO("DebugViewSink : 窗口 \"%s\" 已写入 %zu 帧，后续帧将被丢弃",
+                                     frame.window.c_str(), __options.max_frames);
+            __frame_counters[frame.window] = __options.max_frames + 1;
+            return;
+        }
+        __frame_counters[frame.window] = index + 1;
+    }
+
+    // 叠加层绘制在副本上，不修改识别线程持有的图像数据
+    Mat image = frame.image;
+    if (!frame.overlay.empty() || (__options.output == Output::Video && image.channels() == 1))
+    {
+        Mat canvas;
+        if (image.channels() == 1)
+            cvtColor(image, canvas, COLOR_GRAY2BGR);
+        else
+            canvas = image.clone();
+        frame.overlay.render(canvas);
+        image = canvas;
+    }
+
+    switch (__options.output)
+    {
+    case Output::Display:
+    {
+        ensureWindow(frame.window);
+        imshow(frame.window, image);
+        break;
+    }
+    case Output::ImageSequence:
+    {
+        char file_name[64];
+        snprintf(file_name, sizeof(file_name), "_%06llu.png", static_cast<unsigned long long>(index));
+        imwrite((filesystem::path(__options.output_dir) / (frame.window + file_name)).string(), image);
+        break;
+    }
+    case Output::Video:
+    {
+        auto &writer = __writers[frame.window];
+        if (!writer)
+        {
+            writer = make_unique<VideoWriter>();
+            const auto path = (filesystem::path(__options.output_dir) / (frame.window + ".avi")).string();
+            if (!writer->open(path, VideoWriter::fourcc('M', 'J', 'P', 'G'), __options.video_fps, Size(image.cols, image.rows), true))
+                VISCORE_WARNING_INFO("DebugViewSink : 无法打开视频文件 \"%s\"", path.c_str());
+        }
+        if (writer->isOpened())
+            writer->write(image);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void DebugViewSink::consumeLoop()
+{
+    uint64_t next = 0;
+    Frame frame;
+    while (true)
+    {
+        const uint64_t head = __head.load(memory_order_acquire);
+        // 已被覆盖的帧直接跳过 (由投递端计入丢弃数量)
+        next = max(next, head > __mask + 1 ? head - (__mask + 1) : 0);
+
+        bool progressed = false;
+        while (next < head)
+        {
+            const int result = tryPop(next, frame);
+            if (result < 0)
+                break; // 投递端尚未写完，下一轮再取
+            if (result == 0)
+            {
+                present(frame);
+                frame = Frame();
+            }
+            ++next;
+            progressed = true;
+        }
+
+        applyGuiRequests();
+
+        if (!__running.load(memory_order_acquire) && next >= __head.load(memory_order_acquire))
+            break;
+
+        if (__options.output == Output::Display)
+            waitKey(1); // 处理窗口事件
+        else if (!progressed)
+            this_thread::sleep_for(chrono::milliseconds(1));
+    }
+
+    for (auto &[window, writer] : __writers)
+    {
+        if (writer)
+            writer->release();
+    }
+}
@@ -11,4 +11,20 @@
 /**
  * @brief 参数管理器——添加参数
  */
-#define PARAM_MANAGER_ADD_PARAM(...) YML_ADD_PARAM(__VA_ARGS__)
\ No newline at end of file
+#define PARAM_MANAGER_ADD_PARAM(...) YML_ADD_PARAM(__VA_ARGS__)
+
+/**
+ * @brief 参数管理器——添加带取值范围的参数 (参数, 下限, 上限)
+ */
+#define PARAM_MANAGER_ADD_PARAM_RANGE(...) YML_ADD_PARAM_RANGE(__VA_ARGS__)
+
+/**
+ * @brief 参数管理器——参数快照与文件热加载
+ */
+#include "param_snapshot.hpp"
+#include "param_watcher.h"
+
+/**
+ * @brief 参数管理器——跨进程共享参数块
+ */
+#include "param_shm.h"
@@ -0,0 +1,475 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief 参数结构体的字段表与二进制快照
+ *
+ * 1. PARAM_MANAGER_INIT 中登记的每个参数以访问者的形式展开 (visitParams)，字段表由访问者一次性生成，
+ *    记录字段名、偏移、尺寸、类型与取值范围
+ * 2. 基于字段表提供参数校验、两份参数的差异比较，以及定长字段的二进制快照
+ * 3. 二进制快照仅包含定长字段 (算术类型与 cv::Scalar / Vec / Point 等 OpenCV 定长类型)，
+ *    加载时按字段逐个 memcpy，不经过 YAML 解析
+ *
+ * @note - 字段表以函数内静态变量缓存，每个参数结构体只生成一次
+ *
+ *       - 二进制快照头部包含字段表的哈希，字段增删、改名或改类型后旧快照会被拒绝
+ */
+namespace param_schema
+{
+    //! 未指定下限
+    inline constexpr double NO_MIN = std::numeric_limits<double>::lowest();
+    //! 未指定上限
+    inline constexpr double NO_MAX = std::numeric_limits<double>::max();
+
+    /**
+     * @brief 字段类型
+     */
+    enum class FieldType : std::uint8_t
+    {
+        Bool,     //!< 布尔
+        Integer,  //!< 有符号整数
+        Unsigned, //!< 无符号整数
+        Float,    //!< 浮点数
+        Fixed,    //!< 其他定长类型 (cv::Scalar、cv::Vec、cv::Point 等)
+        String,   //!< 字符串
+        Mat,      //!< cv::Mat
+        Dynamic,  //!< 其他变长类型 (如 std::vector)
+    };
+
+    /**
+     * @brief 是否为可按字节拷贝的定长参数
+     *
+     * @note OpenCV 的小型定长类型声明了拷贝构造函数，不满足 std::is_trivially_copyable，
+     *       但其内存布局仅为定长数组，可安全地按字节拷贝
+     */
+    template <typename _Tp>
+    struct is_fixed_param : std::bool_constant<std::is_trivially_copyable_v<_Tp> && !std::is_pointer_v<_Tp>>
+    {
+    };
+    template <>
+    struct is_fixed_param<cv::Mat> : std::false_type
+    {
+    };
+    template <typename _Tp>
+    struct is_fixed_param<cv::Scalar_<_Tp>> : std::true_type
+    {
+    };
+    template <typename _Tp, int cn>
+    struct is_fixed_param<cv::Vec<_Tp, cn>> : std::true_type
+    {
+    };
+    template <typename _Tp, int m, int n>
+    struct is_fixed_param<cv::Matx<_Tp, m, n>> : std::true_type
+    {
+    };
+    template <typename _Tp>
+    struct is_fixed_param<cv::Point_<_Tp>> : std::true_type
+    {
+    };
+    template <typename _Tp>
+    struct is_fixed_param<cv::Point3_<_Tp>> : std::true_type
+    {
+    };
+    template <typename _Tp>
+    struct is_fixed_param<cv::Size_<_Tp>> : std::true_type
+    {
+    };
+    template <typename _Tp>
+    struct is_fixed_param<cv::Rect_<_Tp>> : std::true_type
+    {
+    };
+    template <typename _Tp>
+    inline constexpr bool is_fixed_param_v = is_fixed_param<std::remove_cv_t<_Tp>>::value;
+
+    /**
+     * @brief 获取字段类型
+     */
+    template <typename _Tp>
+    constexpr FieldType fieldTypeOf()
+    {
+        using T = std::remove_cv_t<_Tp>;
+        if constexpr (std::is_same_v<T, bool>)
+            return FieldType::Bool;
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            return FieldType::Integer;
+        else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            return FieldType::Unsigned;
+        else if constexpr (std::is_floating_point_v<T>)
+            return FieldType::Float;
+        else if constexpr (std::is_same_v<T, cv::Mat>)
+            return FieldType::Mat;
+        else if constexpr (is_fixed_param_v<T>)
+            return FieldType::Fixed;
+        else if constexpr (std::is_same_v<T, std::string>)
+            return FieldType::String;
+        else
+            return FieldType::Dynamic;
+    }
+
+    /**
+     * @brief 字段信息
+     */
+    struct FieldInfo
+    {
+        std::string_view name;           //!< 字段名
+        std::size_t offset = 0;          //!< 相对参数结构体起始地址的偏移
+        std::size_t size = 0;            //!< 字段尺寸
+        FieldType type = FieldType::Dynamic; //!< 字段类型
+        bool fixed = false;              //!< 是否为定长字段 (包含在二进制快照中)
+        double min = NO_MIN;             //!< 取值下限
+        double max = NO_MAX;             //!< 取值上限
+
+        //! 是否指定了取值范围
+        bool hasRange() const noexcept { return min != NO_MIN || max != NO_MAX; }
+    };
+
+    /**
+     * @brief 字段表
+     */
+    struct Schema
+    {
+        std::vector<FieldInfo> fields; //!< 字段 (按登记顺序)
+        std::size_t fixed_size = 0;    //!< 定长字段的总字节数
+        std::size_t dynamic_count = 0; //!< 变长字段数量 (不包含在二进制快照中)
+        std::uint64_t hash = 0;        //!< 字段表哈希 (字段名、类型、尺寸与顺序)
+    };
+
+    /**
+     * @brief 二进制快照头部
+     */
+    struct BinaryHeader
+    {
+        std::uint32_t magic;          //!< 魔数
+        std::uint32_t format_version; //!< 格式版本
+        std::uint64_t schema_hash;    //!< 字段表哈希
+        std::uint64_t payload_size;   //!< 定长字段的总字节数
+    };
+
+    inline constexpr std::uint32_t BINARY_MAGIC = 0x53504356; //!< "VCPS"
+    inline constexpr std::uint32_t BINARY_FORMAT_VERSION = 1; //!< 二进制快照格式版本
+
+    //! FNV-1a 哈希
+    inline std::uint64_t fnv1a(const void *data, std::size_t size, std::uint64_t hash = 0xcbf29ce484222325ull)
+    {
+        const auto *bytes = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief 判断字段是否在取值范围内
+     *
+     * @note 算术类型直接比较；cv::Vec / cv::Scalar / cv::Matx 逐元素比较；其他类型不做检查
+     */
+    template <typename _Tp>
+    inline bool inRange(const _Tp &value, double min, double max)
+    {
+        if constexpr (std::is_arithmetic_v<_Tp>)
+        {
+            return static_cast<double>(value) >= min && static_cast<double>(value) <= max;
+        }
+        else if constexpr (requires { std::size(value.val); })
+        {
+            for (const auto &v : value.val)
+                if (static_cast<double>(v) < min || static_cast<double>(v) > max)
+                    return false;
+            return true;
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    /**
+     * @brief 判断两个字段是否相等
+     *
+     * @note 不支持比较的类型视为不相等
+     */
+    template <typename _Tp>
+    inline bool equal(const _Tp &lhs, const _Tp &rhs)
+    {
+        if constexpr (std::is_same_v<_Tp, cv::Mat>)
+        {
+            if (lhs.size != rhs.size || lhs.type() != rhs.type())
+                return false;
+            return lhs.empty() || cv::norm(lhs, rhs, cv::NORM_INF) == 0;
+        }
+        else if constexpr (requires { static_cast<bool>(lhs == rhs); })
+        {
+            return static_cast<bool>(lhs == rhs);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /**
+     * @brief 生成字段表的访问者
+     */
+    struct SchemaVisitor
+    {
+        const char *base;   //!< 参数结构体起始地址
+        Schema &schema;     //!< 字段表
+
+        template <typename _Tp>
+        void operator()(std::string_view name, const _Tp &value, double min = NO_MIN, double max = NO_MAX)
+        {
+            FieldInfo info;
+            info.name = name;
+            info.offset = static_cast<std::size_t>(reinterpret_cast<const char *>(&value) - base);
+            info.size = sizeof(_Tp);
+            info.type = fieldTypeOf<_Tp>();
+            info.fixed = is_fixed_param_v<_Tp>;
+            info.min = min;
+            info.max = max;
+            if (info.fixed)
+                schema.fixed_size += info.size;
+            else
+                ++schema.dynamic_count;
+
+            schema.hash = fnv1a(name.data(), name.size(), schema.hash);
+            const std::uint64_t layout[2] = {static_cast<std::uint64_t>(info.type), info.size};
+            schema.hash = fnv1a(layout, sizeof(layout), schema.hash);
+            schema.fields.push_back(info);
+        }
+    };
+
+    /**
+     * @brief 生成参数结构体的字段表
+     */
+    template <typename ParamStruct>
+    inline Schema buildSchema(const ParamStruct &param)
+    {
+        Schema schema;
+        schema.hash = fnv1a(nullptr, 0);
+        param.visitParams(SchemaVisitor{reinterpret_cast<const char *>(&param), schema});
+        return schema;
+    }
+
+    /**
+     * @brief 校验参数是否在登记的取值范围内
+     *
+     * @return 超出范围的字段名
+     */
+    template <typename ParamStruct>
+    inline std::vector<std::string_view> validate(const ParamStruct &param)
+    {
+        std::vector<std::string_view> violations;
+        param.visitParams([&violations](std::string_view name, const auto &value, double min = NO_MIN, double max = NO_MAX)
+                          {
+            if (!inRange(value, min, max))
+                violations.push_back(name); });
+        return violations;
+    }
+
+    /**
+     * @brief 比较两份参数
+     *
+     * @return 取值不同的字段名
+     */
+    template <typename ParamStruct>
+    inline std::vector<std::string_view> diff(const ParamStruct &lhs, const ParamStruct &rhs)
+    {
+        std::vector<std::string_view> changed;
+        const char *lhs_base = reinterpret_cast<const char *>(&lhs);
+        const char *rhs_base = reinterpret_cast<const char *>(&rhs);
+        lhs.visitParams([&](std::string_view name, const auto &value, double = NO_MIN, double = NO_MAX)
+                        {
+            using T = std::remove_cvref_t<decltype(value)>;
+            const auto offset = reinterpret_cast<const char *>(&value) - lhs_base;
+            const T &other = *reinterpret_cast<const T *>(rhs_base + offset);
+            if (!equal(value, other))
+                changed.push_back(name); });
+        return changed;
+    }
+
+    /**
+     * @brief 将定长字段按登记顺序写入连续内存
+     *
+     * @param[in] param 参数
+     * @param[out] dst 目标内存，至少 schema().fixed_size 字节
+     */
+    template <typename ParamStruct>
+    inline void writeFixed(const ParamStruct &param, void *dst)
+    {
+        auto *ptr = static_cast<unsigned char *>(dst);
+        param.visitParams([&ptr](std::string_view, const auto &value, double = NO_MIN, double = NO_MAX)
+                          {
+            using T = std::remove_cvref_t<decltype(value)>;
+            if constexpr (is_fixed_param_v<T>)
+            {
+                std::memcpy(ptr, static_cast<const void *>(&value), sizeof(T));
+                ptr += sizeof(T);
+            } });
+    }
+
+    /**
+     * @brief 从连续内存按登记顺序读取定长字段，变长字段保持原值
+     *
+     * @param[out] param 参数
+     * @param[in] src 源内存，至少 schema().fixed_size 字节
+     */
+    template <typename ParamStruct>
+    inline void readFixed(ParamStruct &param, const void *src)
+    {
+        const auto *ptr = static_cast<const unsigned char *>(src);
+        param.visitParams([&ptr](std::string_view, auto &value, double = NO_MIN, double = NO_MAX)
+                          {
+            using T = std::remove_cvref_t<decltype(value)>;
+            if constexpr (is_fixed_param_v<T>)
+            {
+                std::memcpy(static_cast<void *>(&value), ptr, sizeof(T));
+                ptr += sizeof(T);
+            } });
+    }
+
+    /**
+     * @brief 生成二进制快照
+     */
+    template <typename ParamStruct>
+    inline std::vector<std::uint8_t> toBinary(const ParamStruct &param)
+    {
+        const Schema &schema = param.schema();
+        std::vector<std::uint8_t> buffer(sizeof(BinaryHeader) + schema.fixed_size);
+        const BinaryHeader header{BINARY_MAGIC, BINARY_FORMAT_VERSION, schema.hash, schema.fixed_size};
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        writeFixed(param, buffer.data() + sizeof(header));
+        return buffer;
+    }
+
+    /**
+     * @brief 加载二进制快照
+     *
+     * @return 头部与当前字段表一致并加载成功时返回 true，否则参数保持不变
+     */
+    template <typename ParamStruct>
+    inline bool fromBinary(ParamStruct &param, const void *data, std::size_t size)
+    {
+        const Schema &schema = param.schema();
+        if (data == nullptr || size < sizeof(BinaryHeader))
+            return false;
+        BinaryHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (header.magic != BINARY_MAGIC || header.format_version != BINARY_FORMAT_VERSION ||
+            header.schema_hash != schema.hash || header.payload_size != schema.fixed_size ||
+            size < sizeof(BinaryHeader) + schema.fixed_size)
+            return false;
+        readFixed(param, static_cast<const unsigned char *>(data) + sizeof(BinaryHeader));
+        return true;
+    }
+
+    /**
+     * @brief 将二进制快照保存到文件
+     */
+    template <typename ParamStruct>
+    inline bool saveBinary(const ParamStruct &param, const std::string &path)
+    {
+        const auto buffer = toBinary(param);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            return false;
+        file.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return file.good();
+    }
+
+    /**
+     * @brief 从文件加载二进制快照
+     */
+    template <typename ParamStruct>
+    inline bool loadBinary(ParamStruct &param, const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+        const auto size = static_cast<std::size_t>(file.tellg());
+        std::vector<std::uint8_t> buffer(size);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(size)))
+            return false;
+        return fromBinary(param, buffer.data(), buffer.size());
+    }
+
+    /**
+     * @brief 获取 yml 文件对应的二进制快照路径 (同名 .bin 文件)
+     */
+    inline std::string binaryPathOf(const std::string &yml_path)
+    {
+        return std::filesystem::path(yml_path).replace_extension(".bin").string();
+    }
+
+    /**
+     * @brief 判断二进制快照是否可替代 yml 文件：快照存在，且 yml 文件不存在或不比快照新
+     */
+    inline bool binaryIsCurrent(const std::string &yml_path)
+    {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        const auto bin_time = fs::last_write_time(binaryPathOf(yml_path), ec);
+        if (ec)
+            return false;
+        const auto yml_time = fs::last_write_time(yml_path, ec);
+        return ec || yml_time <= bin_time;
+    }
+} // namespace param_schema
+
+/**
+ * @brief 展开参数访问、字段表与二进制快照接口
+ *
+ * @note 登记的参数以 visitor(名称, 参数[, 下限, 上限]) 的形式调用访问者，const 与非 const 各展开一次
+ */
+#define PARAM_SCHEMA_INIT_(ParamStruct, add_param_function...)                                          \
+public:                                                                                                 \
+    template <typename Visitor>                                                                         \
+    void visitParams(Visitor &&visitor)                                                                 \
+    {                                                                                                   \
+        add_param_function                                                                              \
+    }                                                                                                   \
+    template <typename Visitor>                                                                         \
+    void visitParams(Visitor &&visitor) const                                                           \
+    {                                                                                                   \
+        add_param_function                                                                              \
+    }                                                                                                   \
+    /* 字段表 (首次调用时生成) */                                                                       \
+    const param_schema::Schema &schema() const                                                          \
+    {                                                                                                   \
+        static const param_schema::Schema s = param_schema::buildSchema(*this);                         \
+        return s;                                                                                       \
+    }                                                                                                   \
+    /* 超出取值范围的字段名 */                                                                          \
+    std::vector<std::string_view> validate() const { return param_schema::validate(*this); }            \
+    /* 与另一份参数取值不同的字段名 */                                                                  \
+    std::vector<std::string_view> diff(const ParamStruct &other) const                                  \
+    {                                                                                                   \
+        return param_schema::diff(*this, other);                                                        \
+    }                                                                                                   \
+    void writeFixed(void *dst) const { param_schema::writeFixed(*this, dst); }                          \
+    void readFixed(const void *src) { param_schema::readFixed(*this, src); }                            \
+    std::vector<std::uint8_t> toBinary() const { return param_schema::toBinary(*this); }                \
+    bool fromBinary(const void *data, std::size_t size) { return param_schema::fromBinary(*this, data, size); }
+
+/**
+ * @brief 登记参数
+ */
+#define PARAM_SCHEMA_FIELD_(param) visitor(#param, param)
+
+/**
+ * @brief 登记带取值范围的参数
+ */
+#define PARAM_SCHEMA_FIELD_RANGE_(param, min, max) visitor(#param, param, min, max)
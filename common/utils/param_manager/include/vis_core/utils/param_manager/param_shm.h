@@ -0,0 +1,339 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "param_schema.hpp"
+#include "param_snapshot.hpp"
+#include "vis_core/core/logging/logging.h"
+
+/**
+ * @class SharedMemorySegment
+ * @brief POSIX 共享内存段
+ *
+ * @note - 第一个打开者创建并截断为指定大小，其余打开者等待创建者完成截断后映射
+ *
+ *       - 对象析构时解除映射，共享内存段本身由 unlink 显式删除
+ */
+class SharedMemorySegment
+{
+public:
+    using Ptr = std::shared_ptr<SharedMemorySegment>; //!< 智能指针类型
+
+    SharedMemorySegment(void *data, std::size_t size, bool created)
+        : __data(data), __size(size), __created(created) {}
+
+    /**
+     * @brief 析构函数，解除映射
+     */
+    ~SharedMemorySegment();
+
+    SharedMemorySegment(const SharedMemorySegment &) = delete;
+    SharedMemorySegment &operator=(const SharedMemorySegment &) = delete;
+
+    /**
+     * @brief 打开或创建共享内存段
+     *
+     * @param[in] name 共享内存名，不以 '/' 开头时自动补全
+     * @param[in] size 共享内存大小
+     *
+     * @return 共享内存段，失败时返回 nullptr
+     */
+    static Ptr open(const std::string &name, std::size_t size);
+
+    /**
+     * @brief 删除共享内存段 (已映射的进程不受影响)
+     */
+    static bool unlink(const std::string &name);
+
+    //! 映射地址
+    void *data() const noexcept { return __data; }
+
+    //! 映射大小
+    std::size_t size() const noexcept { return __size; }
+
+    //! 是否由当前进程创建
+    bool created() const noexcept { return __created; }
+
+private:
+    void *__data = nullptr; //!< 映射地址
+    std::size_t __size = 0; //!< 映射大小
+    bool __created = false; //!< 是否由当前进程创建
+};
+
+namespace param_shm_details
+{
+    //! 当前进程号
+    int currentProcessId();
+
+    //! 指定进程是否仍然存在 (无法判断时视为存在)
+    bool isProcessAlive(int pid);
+} // namespace param_shm_details
+
+/**
+ * @brief 共享参数块头部
+ *
+ * @note - sequence 为顺序锁计数：奇数表示正在写入，偶数表示数据完整
+ *
+ *       - writer_pid 为持有顺序锁的写入进程号，未持有时为 0
+ */
+struct alignas(64) ParamShmHeader
+{
+    std::atomic<std::uint32_t> magic;  //!< 魔数，创建者初始化完成后最后写入
+    std::uint32_t format_version;      //!< 格式版本
+    std::uint64_t schema_hash;         //!< 字段表哈希
+    std::uint64_t payload_size;        //!< 定长字段的总字节数
+    alignas(64) std::atomic<std::uint64_t> sequence; //!< 顺序锁计数
+    std::atomic<std::uint64_t> version;              //!< 发布次数
+    std::atomic<std::int32_t> writer_pid;            //!< 持有顺序锁的写入进程号
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "共享参数块要求 64 位原子操作无锁");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "共享参数块要求 32 位原子操作无锁");
+
+/**
+ * @class ParamSharedBlock
+ * @brief 基于共享内存与顺序锁的跨进程参数块
+ *
+ * 1. 共享内存中保存参数结构体的定长字段 (与二进制快照的负载格式相同)，不经过 YAML 解析
+ * 2. 调参进程通过 publish 写入新参数，写入期间顺序锁计数为奇数
+ * 3. 识别进程在帧边界调用 sync，仅在版本号变化时复制数据，并以新快照的形式发布到本进程的 ParamSnapshot
+ *
+ * @note - 变长字段 (字符串、cv::Mat 等) 不参与共享，保持各进程自身的取值
+ *
+ *       - 打开时校验字段表哈希，不同版本的参数结构体无法共享同一参数块
+ *
+ *       - 写入进程在写入途中崩溃会使计数停留在奇数，此时读取在重试若干次后失败，参数保持不变；
+ *         下一次 publish 在确认写入进程已退出后接管顺序锁，写入完整数据后恢复为偶数
+ *
+ *       - 仍存活的写入进程即使长时间未完成写入也不会被接管，以免两个进程同时写入数据
+ */
+template <typename ParamStruct>
+class ParamSharedBlock
+{
+public:
+    using Ptr = std::shared_ptr<ParamSharedBlock>; //!< 智能指针类型
+
+    ParamSharedBlock(SharedMemorySegment::Ptr segment) : __segment(std::move(segment)) {}
+
+    /**
+     * @brief 构造接口，打开或创建共享参数块
+     *
+     * @param[in] name 共享内存名
+     * @param[in] initial 由当前进程创建时写入的初始参数
+     *
+     * @return 共享参数块，失败时返回 nullptr
+     */
+    static Ptr create(const std::string &name, const ParamStruct &initial = ParamStruct())
+    {
+        const param_schema::Schema &schema = initial.schema();
+        auto segment = SharedMemorySegment::open(name, sizeof(ParamShmHeader) + schema.fixed_size);
+        if (!segment)
+            return nullptr;
+
+        auto *header = static_cast<ParamShmHeader *>(segment->data());
+        if (segment->created())
+        {
+            header->format_version = param_schema::BINARY_FORMAT_VERSION;
+            header->schema_hash = schema.hash;
+            header->payload_size = schema.fixed_size;
+            header->sequence.store(0, std::memory_order_relaxed);
+            header->version.store(0, std::memory_order_relaxed);
+            header->writer_pid.store(0, std::memory_order_relaxed);
+            initial.writeFixed(payloadOf(header));
+            header->magic.store(param_schema::BINARY_MAGIC, std::memory_order_release);
+        }
+        else
+        {
+            // 等待创建者完成初始化
+            for (int i = 0; header->magic.load(std::memory_order_acquire) != param_schema::BINARY_MAGIC; ++i)
+            {
+                if (i >= __init_timeout_ms)
+                {
+                    VISCORE_WARNING_INFO("ParamSharedBlock : 共享参数块 \"%s\" 未完成初始化", name.c_str());
+                    return nullptr;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (header->format_version != param_schema::BINARY_FORMAT_VERSION ||
+                header->schema_hash != schema.hash || header->payload_size != schema.fixed_size)
+            {
+                VISCORE_WARNING_INFO("ParamSharedBlock : 共享参数块 \"%s\" 的字段表与当前参数结构体不一致", name.c_str());
+                return nullptr;
+            }
+        }
+        return std::make_shared<ParamSharedBlock>(std::move(segment));
+    }
+
+    /**
+     * @brief 删除共享参数块 (已打开的进程不受影响)
+     */
+    static bool remove(const std::string &name) { return SharedMemorySegment::unlink(name); }
+
+    /**
+     * @brief 发布新参数
+     *
+     * @param[in] param 新参数 (仅写入定长字段)
+     *
+     * @return 新的版本号，等待顺序锁超时或顺序锁已被接管时返回 0
+     *
+     * @note - 多个写入进程并发发布时互斥，读取者不会看到部分写入的数据
+     *
+     *       - 顺序锁被已退出的进程持有时接管顺序锁；写入进程在获取顺序锁后、记录进程号前崩溃时无法判断其状态，
+     *         此后的 publish 均超时返回 0，需删除并重新创建共享参数块
+     *
+     *       - 释放顺序锁时校验计数未被改变，若已被接管则不释放并返回 0
+     */
+    std::uint64_t publish(const ParamStruct &param)
+    {
+        using Clock = std::chrono::steady_clock;
+        ParamShmHeader *header = this->header();
+        const auto deadline = Clock::now() + std::chrono::milliseconds(__publish_timeout_ms);
+        std::uint64_t seq = header->sequence.load(std::memory_order_relaxed);
+        std::uint64_t locked = 0;                // 持有顺序锁时的奇数计数
+        while (true)
+        {
+            if (Clock::now() > deadline)
+            {
+                VISCORE_WARNING_INFO("ParamSharedBlock : 等待顺序锁超时，参数未发布");
+                return 0;
+            }
+            if (!(seq & 1))
+            {
+                if (header->sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    locked = seq + 1;
+                    break;
+                }
+                continue;
+            }
+            // 写入进程已退出：以新的奇数计数接管顺序锁，读取者在此期间继续重试
+            const int writer = header->writer_pid.load(std::memory_order_relaxed);
+            if (writer != 0 && !param_shm_details::isProcessAlive(writer))
+            {
+                if (header->sequence.compare_exchange_strong(seq, seq + 2, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    VISCORE_WARNING_INFO("ParamSharedBlock : 写入进程 %d 未完成写入，已接管顺序锁", writer);
+                    locked = seq + 2;
+                    break;
+                }
+                continue;
+            }
+            std::this_thread::yield();
+            seq = header->sequence.load(std::memory_order_relaxed);
+        }
+        const int self = param_shm_details::currentProcessId();
+        header->writer_pid.store(self, std::memory_order_relaxed);
+        // 保证计数变为奇数先于数据写入对其他进程可见
+        std::atomic_thread_fence(std::memory_order_release);
+        param.writeFixed(payloadOf(header));
+        const std::uint64_t version = header->version.fetch_add(1, std::memory_order_relaxed) + 1;
+        int writer = self;
+        header->writer_pid.compare_exchange_strong(writer, 0, std::memory_order_relaxed);
+        if (!header->sequence.compare_exchange_strong(locked, locked + 1, std::memory_order_release, std::memory_order_relaxed))
+        {
+            VISCORE_WARNING_INFO("ParamSharedBlock : 顺序锁已被其他进程接管，本次发布无效");
+            return 0;
+        }
+        return version;
+    }
+
+    /**
+     * @brief 读取参数
+     *
+     * @param[out] param 参数，仅覆盖定长字段
+     * @param[out] version 读取到的版本号 (可选)
+     *
+     * @return 是否读取到完整的数据，失败时参数保持不变
+     */
+    bool read(ParamStruct &param, std::uint64_t *version = nullptr) const
+    {
+        std::vector<std::uint8_t> buffer;
+        if (!readPayload(buffer, version))
+            return false;
+        param.readFixed(buffer.data());
+        return true;
+    }
+
+    /**
+     * @brief 获取当前版本号
+     */
+    std::uint64_t version() const noexcept { return header()->version.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 在帧边界将共享参数同步到本进程的参数快照
+     *
+     * @param[in] snapshot 参数快照
+     *
+     * @return 是否发布了新快照
+     *
+     * @note - 版本号未变化时仅有一次原子读取
+     *
+     *       - 首次调用总是同步，使快照与共享参数块一致
+     */
+    bool sync(ParamSnapshot<ParamStruct> &snapshot)
+    {
+        if (version() == __synced_version.load(std::memory_order_relaxed))
+            return false;
+        std::vector<std::uint8_t> buffer;
+        std::uint64_t current_version = 0;
+        if (!readPayload(buffer, &current_version))
+            return false;
+        snapshot.update([&buffer](ParamStruct &param)
+                        { param.readFixed(buffer.data()); });
+        __synced_version.store(current_version, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    //! 共享参数块头部
+    ParamShmHeader *header() const noexcept { return static_cast<ParamShmHeader *>(__segment->data()); }
+
+    //! 定长字段数据
+    static unsigned char *payloadOf(ParamShmHeader *header) noexcept
+    {
+        return reinterpret_cast<unsigned char *>(header) + sizeof(ParamShmHeader);
+    }
+
+    //! 以顺序锁读取定长字段数据
+    bool readPayload(std::vector<std::uint8_t> &buffer, std::uint64_t *version) const
+    {
+        ParamShmHeader *header = this->header();
+        buffer.resize(header->payload_size);
+        for (int attempt = 0; attempt < __max_read_attempts; ++attempt)
+        {
+            const std::uint64_t begin = header->sequence.load(std::memory_order_acquire);
+            if (begin & 1)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            std::memcpy(buffer.data(), payloadOf(header), buffer.size());
+            const std::uint64_t current_version = header->version.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (header->sequence.load(std::memory_order_relaxed) != begin)
+                continue;
+            if (version != nullptr)
+                *version = current_version;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    static constexpr int __init_timeout_ms = 1000;    //!< 等待创建者初始化的超时时间
+    static constexpr int __max_read_attempts = 1024;  //!< 单次读取的最大重试次数
+    static constexpr int __publish_timeout_ms = 2000; //!< 发布时等待顺序锁的最长时间
+
+    SharedMemorySegment::Ptr __segment;                  //!< 共享内存段
+    std::atomic<std::uint64_t> __synced_version{~std::uint64_t(0)}; //!< 已同步到参数快照的版本号
+};
+
+template <typename ParamStruct>
+using ParamSharedBlock_ptr = std::shared_ptr<ParamSharedBlock<ParamStruct>>; //!< 共享参数块智能指针类型
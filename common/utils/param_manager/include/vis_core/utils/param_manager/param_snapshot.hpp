@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * @class ParamSnapshot
+ * @brief 带版本号的参数快照
+ *
+ * 1. 读者每帧通过 load() 获取一份不可变的参数快照，快照在其持有期间保持不变
+ * 2. 写者通过 publish() / update() 构造新快照并以原子指针交换的方式发布 (RCU 风格)，不阻塞读者
+ * 3. 每次发布版本号加 1，读者可据此判断参数是否发生变化
+ *
+ * @note 旧快照在最后一个持有者释放后析构，读者无需任何同步
+ */
+template <typename _Tp>
+class ParamSnapshot
+{
+public:
+    using Ptr = std::shared_ptr<ParamSnapshot>; //!< 智能指针类型
+    using Snapshot = std::shared_ptr<const _Tp>; //!< 参数快照类型
+
+    /**
+     * @brief 构造函数
+     *
+     * @param[in] initial 初始参数
+     */
+    explicit ParamSnapshot(_Tp initial = _Tp())
+        : __current(std::make_shared<const _Tp>(std::move(initial))) {}
+
+    /**
+     * @brief 构造接口
+     *
+     * @param[in] initial 初始参数
+     */
+    static Ptr create(_Tp initial = _Tp()) { return std::make_shared<ParamSnapshot>(std::move(initial)); }
+
+    /**
+     * @brief 获取当前参数快照
+     */
+    Snapshot load() const noexcept { return __current.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 获取当前版本号
+     */
+    std::uint64_t version() const noexcept { return __version.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 发布新参数
+     *
+     * @param[in] value 新参数
+     *
+     * @return 新的版本号
+     */
+    std::uint64_t publish(_Tp value)
+    {
+        __current.store(std::make_shared<const _Tp>(std::move(value)), std::memory_order_release);
+        return __version.fetch_add(1, std::memory_order_acq_rel) + 1;
+    }
+
+    /**
+     * @brief 基于当前快照修改并发布新参数
+     *
+     * @param[in] modifier 修改函数，参数为当前参数的可修改副本 `_Tp &`
+     *
+     * @return 新的版本号
+     *
+     * @note 多个写者并发修改时通过比较交换重试，不会丢失任何一方的修改
+     */
+    template <typename Modifier>
+    std::uint64_t update(Modifier &&modifier)
+    {
+        Snapshot expected = load();
+        while (true)
+        {
+            _Tp value = *expected;
+            modifier(value);
+            auto desired = std::make_shared<const _Tp>(std::move(value));
+            if (__current.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_acquire))
+                return __version.fetch_add(1, std::memory_order_acq_rel) + 1;
+        }
+    }
+
+private:
+    std::atomic<Snapshot> __current;          //!< 当前参数快照
+    std::atomic<std::uint64_t> __version{0};  //!< 版本号
+};
+
+template <typename _Tp>
+using ParamSnapshot_ptr = std::shared_ptr<ParamSnapshot<_Tp>>; //!< 参数快照智能指针类型
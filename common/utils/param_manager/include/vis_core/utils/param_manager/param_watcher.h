@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "param_snapshot.hpp"
+#include "yml_manager.hpp"
+
+/**
+ * @class ParamFileWatcher
+ * @brief 参数文件监视器
+ *
+ * 1. 基于 inotify 监视参数文件所在目录，文件被写入、替换或重新创建时触发回调
+ * 2. 回调在监视线程中执行，识别线程不受影响
+ *
+ * @note - 监视目录而非文件本身，以兼容编辑器 "写临时文件后重命名" 的保存方式
+ *
+ *       - 同一文件在短时间内的多次事件会被合并为一次回调
+ *
+ *       - watch 返回监视项标识，可通过 unwatch 移除；指定 owner 时，owner 析构后监视项被自动移除
+ *
+ *       - 非 Linux 平台不支持监视，watch 返回 0
+ */
+class ParamFileWatcher
+{
+public:
+    using Ptr = std::shared_ptr<ParamFileWatcher>;                    //!< 智能指针类型
+    using Callback = std::function<void(const std::string &file_path)>; //!< 文件变化回调
+    using WatchId = std::uint64_t;                                      //!< 监视项标识，0 表示无效
+
+private:
+    /**
+     * @brief 监视项
+     */
+    struct WatchItem
+    {
+        WatchId id;                      //!< 监视项标识
+        int wd;                          //!< inotify 监视描述符
+        std::string directory;           //!< 所在目录
+        std::string file_name;           //!< 文件名
+        std::string file_path;           //!< 完整路径
+        Callback callback;               //!< 回调
+        std::weak_ptr<const void> owner; //!< 生命周期绑定的对象
+        bool has_owner;                  //!< 是否绑定了生命周期
+
+        //! 绑定的对象是否已析构
+        bool expired() const { return has_owner && owner.expired(); }
+    };
+
+public:
+    ParamFileWatcher() = default;
+
+    /**
+     * @brief 析构函数，停止监视线程
+     */
+    ~ParamFileWatcher();
+
+    ParamFileWatcher(const ParamFileWatcher &) = delete;
+    ParamFileWatcher &operator=(const ParamFileWatcher &) = delete;
+
+    /**
+     * @brief 构造接口
+     */
+    static Ptr create() { return std::make_shared<ParamFileWatcher>(); }
+
+    /**
+     * @brief 获取进程内共享的监视器
+     */
+    static Ptr instance();
+
+    /**
+     * @brief 监视文件
+     *
+     * @param[in] file_path 文件路径
+     * @param[in] callback 文件变化回调
+     * @param[in] owner 生命周期绑定的对象，为空时监视项保留至 unwatch
+     *
+     * @return 监视项标识，失败时返回 0
+     */
+    WatchId watch(const std::string &file_path, Callback callback, std::weak_ptr<const void> owner = {});
+
+    /**
+     * @brief 移除监视项
+     *
+     * @param[in] id 监视项标识
+     *
+     * @return 监视项是否存在
+     *
+     * @note 可在回调中调用，已进入回调的事件不受影响
+     */
+    bool unwatch(WatchId id);
+
+    /**
+     * @brief 获取当前监视项数量
+     */
+    size_t size();
+
+    /**
+     * @brief 停止监视线程
+     */
+    void stop();
+
+private:
+    //! 初始化 inotify 与监视线程
+    bool start();
+
+    //! 监视线程主循环
+    void watchLoop();
+
+    //! 移除指定位置的监视项，目录不再被任何监视项使用时移除其 inotify 监视 (需持有 __mutex)
+    void eraseItem(size_t index);
+
+    //! 移除生命周期已结束的监视项 (需持有 __mutex)
+    void pruneExpired();
+
+private:
+    int __inotify_fd = -1;                //!< inotify 文件描述符
+    int __wake_fd = -1;                   //!< 用于唤醒监视线程的 eventfd
+    std::atomic<bool> __running{false};   //!< 监视线程是否运行
+    std::mutex __mutex;                   //!< 保护监视项
+    std::vector<WatchItem> __items;       //!< 监视项
+    WatchId __next_id = 1;                //!< 下一个监视项标识
+    std::thread __watch_thread;           //!< 监视线程
+};
+
+using ParamFileWatcher_ptr = std::shared_ptr<ParamFileWatcher>; //!< 参数文件监视器智能指针类型
+
+/**
+ * @brief 监视参数结构体的 yml 文件与合并配置文件，文件变化时重新读取并发布新的参数快照
+ *
+ * @param[in] snapshot 参数快照
+ * @param[in] watcher 参数文件监视器
+ *
+ * @return 是否成功开始监视 (任一文件监视成功即为成功)
+ *
+ * @note - 参数结构体需由 PARAM_MANAGER_INIT 定义，使用其 file_path 与 loadDefault 接口
+ *
+ *       - 重新读取与构造时的 loadDefault 优先级一致：合并配置中的同名节点 > yml 文件，
+ *         因此无论修改的是哪个文件，生效的都是优先级最高的来源
+ *
+ *       - 重新读取基于当前快照的副本，且只读取不回写，避免回写文件再次触发监视
+ *
+ *       - 监视项的生命周期与快照绑定，快照析构后自动移除
+ */
+template <typename ParamStruct>
+inline bool watchParamFile(const ParamSnapshot_ptr<ParamStruct> &snapshot,
+                           const ParamFileWatcher_ptr &watcher = ParamFileWatcher::instance())
+{
+    if (!snapshot || !watcher)
+        return false;
+    std::weak_ptr<ParamSnapshot<ParamStruct>> weak_snapshot = snapshot;
+    auto reload = [weak_snapshot](const std::string &path)
+    {
+        auto snapshot = weak_snapshot.lock();
+        if (!snapshot)
+            return;
+        if (!checkYmlFile(path))
+            return;
+        const auto version = snapshot->update([](ParamStruct &param)
+                                              { param.loadDefault(); });
+        VISCORE_PASS_INFO("参数文件已重新加载: %s (version %llu)", path.c_str(), static_cast<unsigned long long>(version));
+        for (const auto &name : snapshot->load()->validate())
+            VISCORE_WARNING_INFO("参数超出取值范围: %.*s (%s)", static_cast<int>(name.size()), name.data(), path.c_str());
+    };
+
+    bool watched = watcher->watch(snapshot->load()->file_path, reload, snapshot) != 0;
+    const std::string combined_path = yml_manager::combinedConfigPath();
+    if (!combined_path.empty())
+        watched |= watcher->watch(combined_path, reload, snapshot) != 0;
+    return watched;
+}
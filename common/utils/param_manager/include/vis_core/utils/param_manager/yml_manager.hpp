@@ -1,13 +1,17 @@
 #pragma once
 
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <opencv2/opencv.hpp>
 #include <string>
 #include <unordered_map>
 
 #include "vis_core/core/logging/logging.h"
+#include "param_schema.hpp"
 
 #define YML_DEBUG 1
 #if YML_DEBUG
@@ -22,28 +26,143 @@
 
 namespace yml_manager
 {
+    //! 参数根目录环境变量名
+    inline constexpr const char *PARAM_ROOT_ENV = "VISCORE_PARAM_ROOT";
+    //! 合并配置文件名 (位于参数根目录下，顶层节点名为参数结构体的类名)
+    inline constexpr const char *COMBINED_CONFIG_NAME = "params.yml";
+
     /**
-     * @brief 生成yml文件路径
+     * @brief 合并配置中某一参数结构体的节点
+     *
+     * @note storage 保证 node 在使用期间有效
      */
-    inline std::string generateYmlPath(const std::string &source_file_path, const std::string &class_name)
+    struct ConfigNode
     {
-        namespace fs = std::filesystem;
+        std::shared_ptr<const cv::FileStorage> storage; //!< 合并配置文件
+        cv::FileNode node;                              //!< 参数结构体对应的节点
+    };
+
+    /**
+     * @brief 参数根目录与合并配置的运行时状态
+     */
+    struct ParamRootState
+    {
+        std::mutex mutex;                               //!< 保护以下成员
+        std::string root;                               //!< 参数根目录
+        bool root_initialized = false;                  //!< 是否已确定参数根目录
+        std::shared_ptr<const cv::FileStorage> combined; //!< 合并配置文件
+        bool combined_loaded = false;                   //!< 是否已尝试解析合并配置
+        std::filesystem::file_time_type combined_time;  //!< 解析时合并配置文件的修改时间
+    };
 
-        // 获取头文件所在目录
-        fs::path header_dir = fs::path(source_file_path).parent_path();
+    inline ParamRootState &paramRootState()
+    {
+        static ParamRootState state;
+        return state;
+    }
 
-        // 构建目标路径：头文件目录/yml/类名.yml
-        fs::path yml_path = header_dir / "yml" / (class_name + ".yml");
+    /**
+     * @brief 设置参数根目录
+     *
+     * @param[in] root 参数根目录，为空时回退到头文件所在目录下的 yml 目录
+     *
+     * @note 须在参数结构体构造之前调用，设置后会重新解析合并配置
+     */
+    inline void setParamRoot(const std::string &root)
+    {
+        auto &state = paramRootState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.root = root;
+        state.root_initialized = true;
+        state.combined.reset();
+        state.combined_loaded = false;
+    }
 
-        // 自动创建yml目录
-        if (!fs::exists(yml_path.parent_path()))
+    /**
+     * @brief 获取参数根目录
+     *
+     * @note 未通过 setParamRoot 设置时读取环境变量 VISCORE_PARAM_ROOT
+     */
+    inline std::string paramRoot()
+    {
+        auto &state = paramRootState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.root_initialized)
         {
-            fs::create_directories(yml_path.parent_path());
-            YML_DEBUG_INFO_("自动创建配置目录: %s",
-                            yml_path.parent_path().string().c_str());
+            const char *env = std::getenv(PARAM_ROOT_ENV);
+            state.root = (env != nullptr) ? env : "";
+            state.root_initialized = true;
         }
+        return state.root;
+    }
 
-        return yml_path.string();
+    /**
+     * @brief 获取合并配置文件路径
+     *
+     * @note 未设置参数根目录时返回空字符串，仅拼接路径，不访问文件系统
+     */
+    inline std::string combinedConfigPath()
+    {
+        const std::string root = paramRoot();
+        return root.empty() ? std::string() : (std::filesystem::path(root) / COMBINED_CONFIG_NAME).string();
+    }
+
+    /**
+     * @brief 获取合并配置中指定名称的节点
+     *
+     * @param[in] name 节点名 (参数结构体的类名，指定配置名时为 类名_配置名)
+     *
+     * @note 合并配置文件由所有参数结构体共享，仅在文件修改时间变化时重新解析
+     */
+    inline ConfigNode combinedConfigNode(const std::string &name)
+    {
+        const std::string combined_path = combinedConfigPath();
+        auto &state = paramRootState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::error_code ec;
+        const bool exists = !combined_path.empty() && std::filesystem::is_regular_file(combined_path, ec);
+        const auto time = exists ? std::filesystem::last_write_time(combined_path, ec) : std::filesystem::file_time_type();
+        if (!state.combined_loaded || time != state.combined_time)
+        {
+            state.combined_loaded = true;
+            state.combined_time = time;
+            state.combined.reset();
+            if (exists)
+            {
+                auto storage = std::make_shared<cv::FileStorage>(combined_path, cv::FileStorage::READ);
+                if (storage->isOpened())
+                    state.combined = std::move(storage);
+                else
+                    YML_DEBUG_WARNING_("合并配置文件解析失败: %s", combined_path.c_str());
+            }
+        }
+        if (!state.combined)
+            return {};
+        return {state.combined, (*state.combined)[name]};
+    }
+
+    /**
+     * @brief 生成yml文件路径
+     *
+     * @note - 设置了参数根目录时为 参数根目录/类名.yml，否则为 头文件目录/yml/类名.yml
+     *
+     *       - 指定配置名时文件名为 类名_配置名.yml
+     *
+     *       - 仅拼接路径，不访问文件系统
+     */
+    inline std::string generateYmlPath(const std::string &source_file_path, const std::string &class_name,
+                                       const std::string &profile = std::string())
+    {
+        namespace fs = std::filesystem;
+
+        const std::string file_name = (profile.empty() ? class_name : class_name + "_" + profile) + ".yml";
+        const std::string root = paramRoot();
+        if (!root.empty())
+            return (fs::path(root) / file_name).string();
+
+        // 头文件目录/yml/文件名
+        return (fs::path(source_file_path).parent_path() / "yml" / file_name).string();
     }
 
 } // namespace yml_manager
@@ -75,12 +194,27 @@ namespace yml_manager
 #define YML_MANAGER_PARAM_FILE_PATH_ \
     yml_manager::generateYmlPath(__FILE__, YML_MANAGER_CURRENT_CLASS_NAME_)
 
-// 添加参数加载的构造函数
-#define YML_MANAGER_CONSTRUCTOR_INIT(ParamStruct) \
-    ParamStruct()                                 \
-    {                                             \
-        file_path = YML_MANAGER_PARAM_FILE_PATH_; \
-        load(file_path);                          \
+/**
+ * @brief 生成指定配置名的yml文件路径
+ *
+ * @param profile 配置名
+ *
+ * @return std::string yml文件路径
+ */
+#define YML_MANAGER_PROFILE_FILE_PATH_(profile) \
+    yml_manager::generateYmlPath(__FILE__, YML_MANAGER_CURRENT_CLASS_NAME_, profile)
+
+// 添加参数加载的构造函数 (默认配置与指定配置名)，仅读取不回写
+#define YML_MANAGER_CONSTRUCTOR_INIT(ParamStruct)                 \
+    ParamStruct()                                                 \
+    {                                                             \
+        file_path = YML_MANAGER_PARAM_FILE_PATH_;                 \
+        loadDefault();                                            \
+    }                                                             \
+    explicit ParamStruct(const std::string &profile)              \
+    {                                                             \
+        file_path = YML_MANAGER_PROFILE_FILE_PATH_(profile);      \
+        loadDefault();                                            \
     }
 
 enum YmlType : unsigned int
@@ -110,68 +244,96 @@ inline bool checkYmlFile(const std::string &file_path)
 }
 
 // 进行参数模块初始化
-#define YML_INIT(ParamStruct, add_param_function...)                                                            \
-public:                                                                                                         \
-    YML_MANAGER_CONSTRUCTOR_INIT(ParamStruct)                                                                   \
-    std::string file_path;                                                                                      \
-                                                                                                                \
-public:                                                                                                         \
-    void load(const cv::String &file_path, YmlType type = static_cast<YmlType>(YmlType::READ | YmlType::WRITE)) \
-    {                                                                                                           \
-        if (file_path.empty())                                                                                  \
-        {                                                                                                       \
-            YML_DEBUG_WARNING_("yml文件路径为空: %s\n", file_path.c_str());                                     \
-            return;                                                                                             \
-        }                                                                                                       \
-        if (type & YmlType::READ)                                                                               \
-        {                                                                                                       \
-            cv::FileStorage fs(file_path, cv::FileStorage::READ);                                               \
-            if (!fs.isOpened())                                                                                 \
-            {                                                                                                   \
-                YML_DEBUG_PASS_("yml 文件不存在,但路径存在,创建并初始化 yml 文件: %s\n", file_path.c_str());    \
-            }                                                                                                   \
-            bool is_read = true;                                                                                \
-            add_param_function                                                                                  \
-        }                                                                                                       \
-        if (type & YmlType::WRITE)                                                                              \
-        {                                                                                                       \
-            cv::FileStorage fs(file_path, cv::FileStorage::WRITE);                                              \
-            if (!fs.isOpened())                                                                                 \
-            {                                                                                                   \
-                YML_DEBUG_WARNING_("yml文件打开失败: %s\n", file_path.c_str());                                 \
-                return;                                                                                         \
-            }                                                                                                   \
-            bool is_read = false;                                                                               \
-            add_param_function                                                                                  \
-        }                                                                                                       \
+#define YML_INIT(ParamStruct, add_param_function...)                                                         \
+public:                                                                                                      \
+    YML_MANAGER_CONSTRUCTOR_INIT(ParamStruct)                                                                \
+    std::string file_path;                                                                                   \
+    PARAM_SCHEMA_INIT_(ParamStruct, add_param_function)                                                      \
+                                                                                                             \
+public:                                                                                                      \
+    /* 从 yml 节点读取参数，缺失的参数保持原值 */                                                            \
+    void read(const cv::FileNode &node) { visitParams(YmlReadVisitor{node}); }                               \
+    /* 将参数写入 yml 文件 */                                                                                \
+    void write(cv::FileStorage &fs) const { visitParams(YmlWriteVisitor{fs}); }                              \
+    /* 默认加载：合并配置中的同名节点 > 不旧于 yml 文件的二进制快照 > yml 文件 */                           \
+    void loadDefault()                                                                                       \
+    {                                                                                                        \
+        const auto combined = yml_manager::combinedConfigNode(                                               \
+            std::filesystem::path(file_path).stem().string());                                               \
+        if (combined.node.isMap())                                                                           \
+        {                                                                                                    \
+            read(combined.node);                                                                             \
+            return;                                                                                          \
+        }                                                                                                    \
+        /* 仅含定长字段时可完全由二进制快照恢复 */                                                           \
+        if (schema().dynamic_count == 0 && param_schema::binaryIsCurrent(file_path) &&                       \
+            param_schema::loadBinary(*this, param_schema::binaryPathOf(file_path)))                          \
+            return;                                                                                          \
+        load(file_path, YmlType::READ);                                                                      \
+    }                                                                                                        \
+    void load(const cv::String &file_path, YmlType type = YmlType::READ)                                     \
+    {                                                                                                        \
+        if (file_path.empty())                                                                               \
+        {                                                                                                    \
+            YML_DEBUG_WARNING_("yml文件路径为空: %s\n", file_path.c_str());                                  \
+            return;                                                                                          \
+        }                                                                                                    \
+        if (type & YmlType::READ)                                                                            \
+        {                                                                                                    \
+            cv::FileStorage fs(file_path, cv::FileStorage::READ);                                            \
+            if (!fs.isOpened())                                                                              \
+            {                                                                                                \
+                YML_DEBUG_INFO_("yml 文件不存在，使用默认参数: %s", file_path.c_str());                      \
+            }                                                                                                \
+            else                                                                                             \
+            {                                                                                                \
+                read(fs.root());                                                                             \
+            }                                                                                                \
+        }                                                                                                    \
+        if (type & YmlType::WRITE)                                                                           \
+        {                                                                                                    \
+            cv::FileStorage fs(file_path, cv::FileStorage::WRITE);                                           \
+            if (!fs.isOpened())                                                                              \
+            {                                                                                                \
+                YML_DEBUG_WARNING_("yml文件打开失败: %s\n", file_path.c_str());                              \
+                return;                                                                                      \
+            }                                                                                                \
+            write(fs);                                                                                       \
+        }                                                                                                    \
+    }                                                                                                        \
+    /* 显式保存参数，为空时保存到 file_path */                                                               \
+    void save(const cv::String &path = cv::String())                                                         \
+    {                                                                                                        \
+        load(path.empty() ? cv::String(file_path) : path, YmlType::WRITE);                                   \
     }
 
-#define YML_ADD_PARAM(param)               \
-    do                                     \
-    {                                      \
-        if (is_read)                       \
-        {                                  \
-            readParam(fs, #param, param);  \
-        }                                  \
-        else                               \
-        {                                  \
-            writeParam(fs, #param, param); \
-        }                                  \
-    } while (false)
+#define YML_ADD_PARAM(param) PARAM_SCHEMA_FIELD_(param)
+
+// 添加带取值范围的参数，范围用于 validate()
+#define YML_ADD_PARAM_RANGE(param, min, max) PARAM_SCHEMA_FIELD_RANGE_(param, min, max)
 
 // 读取参数
 template <typename _Tp>
-inline void readParam(const cv::FileStorage &fs, const cv::String &name, _Tp &param)
+inline void readParam(const cv::FileNode &node, const cv::String &name, _Tp &param)
 {
-    fs[name].isNone() ? void(0) : fs[name] >> param;
+    const cv::FileNode item = node[name];
+    item.isNone() ? void(0) : item >> param;
 }
 template <>
-inline void readParam<size_t>(const cv::FileStorage &fs, const cv::String &name, size_t &param)
+inline void readParam<size_t>(const cv::FileNode &node, const cv::String &name, size_t &param)
 {
+    const cv::FileNode item = node[name];
+    if (item.isNone())
+        return;
     int temp = 0;
-    fs[name].isNone() ? void(0) : fs[name] >> temp;
+    item >> temp;
     param = static_cast<size_t>(temp);
 }
+template <typename _Tp>
+inline void readParam(const cv::FileStorage &fs, const cv::String &name, _Tp &param)
+{
+    readParam(fs.root(), name, param);
+}
 
 // 写入参数
 template <typename _Tp>
@@ -185,6 +347,30 @@ inline void writeParam<size_t>(cv::FileStorage &fs, const cv::String &name, cons
     fs << name << static_cast<int>(param);
 }
 
+// 读取 yml 节点的参数访问者
+struct YmlReadVisitor
+{
+    const cv::FileNode &node;
+
+    template <typename _Tp>
+    void operator()(std::string_view name, _Tp &param, double = param_schema::NO_MIN, double = param_schema::NO_MAX) const
+    {
+        readParam(node, cv::String(name), param);
+    }
+};
+
+// 写入 yml 文件的参数访问者
+struct YmlWriteVisitor
+{
+    cv::FileStorage &fs;
+
+    template <typename _Tp>
+    void operator()(std::string_view name, const _Tp &param, double = param_schema::NO_MIN, double = param_schema::NO_MAX) const
+    {
+        writeParam(fs, cv::String(name), param);
+    }
+};
+
 // yml 文件管理器
 class YmlManager
 {
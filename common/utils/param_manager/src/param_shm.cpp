@@ -0,0 +1,134 @@
+#include "vis_core/utils/param_manager/param_shm.h"
+
+#include <chrono>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+//! 等待创建者完成截断的超时时间
+static constexpr auto create_timeout = chrono::seconds(1);
+
+/**
+ * @brief 规范化共享内存名 (以 '/' 开头)
+ */
+static string normalizeName(const string &name)
+{
+    return (!name.empty() && name.front() == '/') ? name : "/" + name;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+int param_shm_details::currentProcessId()
+{
+    return static_cast<int>(getpid());
+}
+
+bool param_shm_details::isProcessAlive(int pid)
+{
+    // 仅在确认进程不存在时返回 false，无权限发送信号的进程视为存在
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    if (__data != nullptr)
+        munmap(__data, __size);
+}
+
+SharedMemorySegment::Ptr SharedMemorySegment::open(const string &name, size_t size)
+{
+    if (name.empty() || size == 0)
+        return nullptr;
+    const string shm_name = normalizeName(name);
+
+    bool created = true;
+    int fd = shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+    if (fd >= 0)
+    {
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            VISCORE_WARNING_INFO("SharedMemorySegment : 无法设置共享内存 \"%s\" 的大小", shm_name.c_str());
+            close(fd);
+            shm_unlink(shm_name.c_str());
+            return nullptr;
+        }
+    }
+    else
+    {
+        created = false;
+        fd = shm_open(shm_name.c_str(), O_RDWR, 0666);
+        if (fd < 0)
+        {
+            VISCORE_WARNING_INFO("SharedMemorySegment : 无法打开共享内存 \"%s\"", shm_name.c_str());
+            return nullptr;
+        }
+        // 等待创建者完成截断
+        const auto deadline = chrono::steady_clock::now() + create_timeout;
+        struct stat st{};
+        while (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) < size)
+        {
+            if (chrono::steady_clock::now() > deadline)
+            {
+                VISCORE_WARNING_INFO("SharedMemorySegment : 共享内存 \"%s\" 的大小 (%lld) 小于所需大小 (%zu)",
+                                     shm_name.c_str(), static_cast<long long>(st.st_size), size);
+                close(fd);
+                return nullptr;
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        VISCORE_WARNING_INFO("SharedMemorySegment : 无法映射共享内存 \"%s\"", shm_name.c_str());
+        return nullptr;
+    }
+    return make_shared<SharedMemorySegment>(data, size, created);
+}
+
+bool SharedMemorySegment::unlink(const string &name)
+{
+    return shm_unlink(normalizeName(name).c_str()) == 0;
+}
+
+#else
+
+int param_shm_details::currentProcessId()
+{
+    return 0;
+}
+
+bool param_shm_details::isProcessAlive(int pid)
+{
+    (void)pid;
+    return true;
+}
+
+SharedMemorySegment::~SharedMemorySegment() {}
+
+SharedMemorySegment::Ptr SharedMemorySegment::open(const string &name, size_t size)
+{
+    (void)name;
+    (void)size;
+    VISCORE_WARNING_INFO("SharedMemorySegment : 当前平台不支持 POSIX 共享内存");
+    return nullptr;
+}
+
+bool SharedMemorySegment::unlink(const string &name)
+{
+    (void)name;
+    return false;
+}
+
+#endif
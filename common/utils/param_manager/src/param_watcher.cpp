@@ -0,0 +1,255 @@
+#include "vis_core/utils/param_manager/param_watcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+//! 合并同一文件连续事件的时间窗口
+static constexpr auto debounce_window = chrono::milliseconds(50);
+
+ParamFileWatcher::~ParamFileWatcher()
+{
+    stop();
+}
+
+ParamFileWatcher::Ptr ParamFileWatcher::instance()
+{
+    static Ptr watcher = create();
+    return watcher;
+}
+
+#ifdef __linux__
+
+bool ParamFileWatcher::start()
+{
+    if (__running.load(memory_order_acquire))
+        return true;
+
+    __inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (__inotify_fd < 0)
+    {
+        VISCORE_WARNING_INFO("ParamFileWatcher : inotify 初始化失败");
+        return false;
+    }
+    __wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (__wake_fd < 0)
+    {
+        VISCORE_WARNING_INFO("ParamFileWatcher : eventfd 初始化失败");
+        close(__inotify_fd);
+        __inotify_fd = -1;
+        return false;
+    }
+    __running.store(true, memory_order_release);
+    __watch_thread = thread(&ParamFileWatcher::watchLoop, this);
+    return true;
+}
+
+ParamFileWatcher::WatchId ParamFileWatcher::watch(const string &file_path, Callback callback, weak_ptr<const void> owner)
+{
+    namespace fs = filesystem;
+    if (file_path.empty() || !callback)
+        return 0;
+
+    lock_guard<mutex> lock(__mutex);
+    if (!start())
+        return 0;
+    pruneExpired();
+
+    const fs::path path = fs::absolute(fs::path(file_path));
+    const string directory = path.parent_path().string();
+    const int wd = inotify_add_watch(__inotify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (wd < 0)
+    {
+        VISCORE_WARNING_INFO("ParamFileWatcher : 无法监视目录 %s", directory.c_str());
+        return 0;
+    }
+    const bool has_owner = !owner.expired();
+    const WatchId id = __next_id++;
+    __items.push_back({id, wd, directory, path.filename().string(), path.string(), std::move(callback),
+                       std::move(owner), has_owner});
+    return id;
+}
+
+bool ParamFileWatcher::unwatch(WatchId id)
+{
+    lock_guard<mutex> lock(__mutex);
+    auto it = find_if(__items.begin(), __items.end(), [id](const WatchItem &item)
+                      { return item.id == id; });
+    if (it == __items.end())
+        return false;
+    eraseItem(static_cast<size_t>(it - __items.begin()));
+    return true;
+}
+
+size_t ParamFileWatcher::size()
+{
+    lock_guard<mutex> lock(__mutex);
+    pruneExpired();
+    return __items.size();
+}
+
+void ParamFileWatcher::eraseItem(size_t index)
+{
+    const int wd = __items[index].wd;
+    __items.erase(__items.begin() + static_cast<ptrdiff_t>(index));
+    // 同一目录的多个监视项共享同一 inotify 监视描述符
+    const bool shared = any_of(__items.begin(), __items.end(), [wd](const WatchItem &item)
+                               { return item.wd == wd; });
+    if (!shared && __inotify_fd >= 0)
+        inotify_rm_watch(__inotify_fd, wd);
+}
+
+void ParamFileWatcher::pruneExpired()
+{
+    for (size_t i = __items.size(); i-- > 0;)
+    {
+        if (__items[i].expired())
+            eraseItem(i);
+    }
+}
+
+void ParamFileWatcher::stop()
+{
+    if (__running.exchange(false, memory_order_acq_rel))
+    {
+        const uint64_t one = 1;
+        [[maybe_unused]] auto ret = write(__wake_fd, &one, sizeof(one));
+        if (__watch_thread.joinable())
+            __watch_thread.join();
+    }
+    if (__inotify_fd >= 0)
+    {
+        close(__inotify_fd);
+        __inotify_fd = -1;
+    }
+    if (__wake_fd >= 0)
+    {
+        close(__wake_fd);
+        __wake_fd = -1;
+    }
+}
+
+void ParamFileWatcher::watchLoop()
+{
+    alignas(inotify_event) char buffer[4096];
+    // 待触发的监视项标识及其最近一次事件时间
+    vector<pair<WatchId, chrono::steady_clock::time_point>> pending;
+
+    while (__running.load(memory_order_acquire))
+    {
+        pollfd fds[2] = {{__inotify_fd, POLLIN, 0}, {__wake_fd, POLLIN, 0}};
+        const int timeout = pending.empty() ? -1 : static_cast<int>(debounce_window.count());
+        if (poll(fds, 2, timeout) < 0)
+            continue;
+        if (fds[1].revents & POLLIN)
+            break;
+
+        if (fds[0].revents & POLLIN)
+        {
+            ssize_t length;
+            while ((length = read(__inotify_fd, buffer, sizeof(buffer))) > 0)
+            {
+                for (char *ptr = buffer; ptr < buffer + length;)
+                {
+                    const auto *event = reinterpret_cast<const inotify_event *>(ptr);
+                    ptr += sizeof(inotify_event) + event->len;
+                    if (event->len == 0)
+                        continue;
+
+                    lock_guard<mutex> lock(__mutex);
+                    pruneExpired();
+                    for (const auto &item : __items)
+                    {
+                        if (item.wd != event->wd || item.file_name != event->name)
+                            continue;
+                        const WatchId id = item.id;
+                        auto it = find_if(pending.begin(), pending.end(), [id](const auto &p)
+                                          { return p.first == id; });
+                        const auto now = chrono::steady_clock::now();
+                        if (it == pending.end())
+                            pending.emplace_back(id, now);
+                        else
+                            it->second = now;
+                    }
+                }
+            }
+        }
+
+        // 触发已静默超过时间窗口的监视项
+        const auto now = chrono::steady_clock::now();
+        for (auto it = pending.begin(); it != pending.end();)
+        {
+            if (now - it->second < debounce_window)
+            {
+                ++it;
+                continue;
+            }
+            string file_path;
+            Callback callback;
+            {
+                // 监视项可能已在等待期间被移除
+                lock_guard<mutex> lock(__mutex);
+                const WatchId id = it->first;
+                auto item = find_if(__items.begin(), __items.end(), [id](const WatchItem &item)
+                                    { return item.id == id && !item.expired(); });
+                if (item != __items.end())
+                {
+                    file_path = item->file_path;
+                    callback = item->callback;
+                }
+            }
+            if (callback)
+                callback(file_path);
+            it = pending.erase(it);
+        }
+    }
+}
+
+#else
+
+bool ParamFileWatcher::start()
+{
+    return false;
+}
+
+ParamFileWatcher::WatchId ParamFileWatcher::watch(const string &file_path, Callback callback, weak_ptr<const void> owner)
+{
+    (void)file_path;
+    (void)callback;
+    (void)owner;
+    VISCORE_WARNING_INFO("ParamFileWatcher : 当前平台不支持参数文件监视");
+    return 0;
+}
+
+bool ParamFileWatcher::unwatch(WatchId id)
+{
+    (void)id;
+    return false;
+}
+
+size_t ParamFileWatcher::size()
+{
+    return 0;
+}
+
+void ParamFileWatcher::eraseItem(size_t index)
+{
+    (void)index;
+}
+
+void ParamFileWatcher::pruneExpired() {}
+
+void ParamFileWatcher::stop() {}
+
+void ParamFileWatcher::watchLoop() {}
+
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/core/property_wrapper/property_wrapper.hpp"
+#include "vis_core/math/pose_proc/pose_node.h"
+#include "vis_core/utils/camera/camera_wrapper.h"
+#include "vis_core/visual/feature_node/quadrilateral.h"
+
+/**
+ * @class QuadPoseSolver
+ * @brief 四边形特征的批量位姿解算器
+ *
+ * 1. 四边形模型为 z = 0 平面上以原点为中心、宽 width 高 height 的矩形，x 轴向右、y 轴向下
+ * 2. 角点顺序依次为 左上、右上、右下、左下
+ * 3. 角点去畸变后由闭式公式计算单应矩阵，再使用 IPPE 方法求出平面位姿的两个候选解，选取重投影误差较小者
+ * 4. 可选若干次 Gauss-Newton 迭代优化重投影误差，默认不优化 (启用后吞吐量下降，参见 tests/quad_pose_solver_bench)
+ * 5. 跟踪中的特征可以上一帧的位姿为初值，仅执行少量 Levenberg-Marquardt 迭代 (热启动)，
+ *    残差超过阈值时回退到完整解算
+ *
+ * @note - 单个四边形的解算全部使用定长矩阵，不分配堆内存
+ *
+ *       - 解得的位姿为 camera_to_feature，写入特征位姿缓存时以 CameraFrame 为键
+ *
+ *       - 热启动的命中率与迭代次数通过 statistics() 获取，统计计数可被多个线程同时更新
+ */
+class QuadPoseSolver
+{
+public:
+    using Ptr = std::shared_ptr<QuadPoseSolver>;   //!< 智能指针类型
+    using Corners = std::array<cv::Point2f, 4>; //!< 四边形角点 (左上、右上、右下、左下)
+
+    /**
+     * @brief 单个四边形的解算结果
+     */
+    struct Result
+    {
+        Transform6D camera_to_feature; //!< 特征在相机坐标系下的位姿
+        double rms_error = 0;          //!< 重投影误差均方根 (像素)
+        bool valid = false;            //!< 是否解算成功
+        bool warm_started = false;     //!< 是否由热启动得到
+        int iterations = 0;            //!< 热启动执行的迭代次数
+    };
+
+    /**
+     * @brief 热启动统计
+     */
+    struct Statistics
+    {
+        std::uint64_t warm_attempts = 0; //!< 热启动尝试次数
+        std::uint64_t warm_hits = 0;     //!< 热启动成功次数 (残差未超过阈值)
+        std::uint64_t iterations = 0;    //!< 热启动累计迭代次数
+        std::uint64_t full_solves = 0;   //!< 完整解算次数
+
+        //! 热启动命中率
+        double hitRate() const noexcept { return warm_attempts == 0 ? 0 : static_cast<double>(warm_hits) / warm_attempts; }
+
+        //! 每次热启动的平均迭代次数
+        double meanIterations() const noexcept { return warm_attempts == 0 ? 0 : static_cast<double>(iterations) / warm_attempts; }
+    };
+
+    //! Gauss-Newton 优化的迭代次数 (0 表示不优化)
+    DEFINE_PROPERTY_WITH_INIT(RefineIterations, public, public, (int), 0);
+    //! 写入特征位姿缓存时使用的相机坐标系
+    DEFINE_PROPERTY_WITH_INIT(CameraFrame, public, public, (FrameId), FrameId::intern("camera"));
+    //! 批量解算特征时是否以位姿缓存中的上一帧位姿热启动
+    DEFINE_PROPERTY_WITH_INIT(WarmStart, public, public, (bool), true);
+    //! 热启动的最大 Levenberg-Marquardt 迭代次数
+    DEFINE_PROPERTY_WITH_INIT(WarmIterations, public, public, (int), 3);
+    //! 热启动可接受的最大重投影误差均方根 (像素)，超过时回退到完整解算
+    DEFINE_PROPERTY_WITH_INIT(WarmMaxError, public, public, (double), 1.0);
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param[in] camera 相机
+     * @param[in] width 四边形模型宽度
+     * @param[in] height 四边形模型高度
+     */
+    QuadPoseSolver(const CameraWrapper_ptr &camera, double width, double height);
+
+    /**
+     * @brief 构造接口
+     *
+     * @param[in] camera 相机
+     * @param[in] width 四边形模型宽度
+     * @param[in] height 四边形模型高度
+     */
+    static Ptr create(const CameraWrapper_ptr &camera, double width, double height)
+    {
+        return std::make_shared<QuadPoseSolver>(camera, width, height);
+    }
+
+    /**
+     * @brief 解算单个四边形的位姿
+     *
+     * @param[in] corners 四边形角点 (像素坐标，含畸变)
+     * @return 解算结果
+     */
+    Result solve(const Corners &corners) const;
+
+    /**
+     * @brief 以给定位姿为初值优化单个四边形的位姿 (热启动)
+     *
+     * @param[in] corners 四边形角点 (像素坐标，含畸变)
+     * @param[in] initial 初始位姿 camera_to_feature，通常为上一帧的解
+     * @return 解算结果，重投影误差超过 WarmMaxError 或初值不合法时 valid 为 false
+     */
+    Result refine(const Corners &corners, const Transform6D &initial) const;
+
+    /**
+     * @brief 批量解算四边形的位姿
+     *
+     * @param[in] corners 各四边形的角点
+     * @param[out] results 各四边形的解算结果，数量须与 corners 一致
+     */
+    void solve(std::span<const Corners> corners, std::span<Result> results) const;
+
+    /**
+     * @brief 批量解算四边形特征的位姿并写入特征的位姿缓存
+     *
+     * @param[in] features 四边形特征
+     * @return 解算成功的特征数量
+     *
+     * @note - 角点数量不为 4 或解算失败的特征不写入位姿缓存
+     *
+     *       - 启用 WarmStart 且位姿缓存中已有 CameraFrame 下的位姿时先尝试热启动，失败后回退到完整解算
+     */
+    std::size_t solve(std::span<const QuadrilateralBase_ptr> features) const;
+
+    /**
+     * @brief 四边形模型的角点 (左上、右上、右下、左下)
+     */
+    const std::array<cv::Point3d, 4> &modelPoints() const noexcept { return __model_points; }
+
+    /**
+     * @brief 获取热启动统计
+     */
+    Statistics statistics() const noexcept;
+
+    /**
+     * @brief 清空热启动统计
+     */
+    void resetStatistics() noexcept;
+
+private:
+    CameraWrapper_ptr __camera;                  //!< 相机
+    std::array<cv::Point3d, 4> __model_points;   //!< 四边形模型角点
+    cv::Matx33d __model_to_square;               //!< 模型平面到单位正方形的变换
+    double __focal = 1;                          //!< 平均焦距，用于将归一化误差换算为像素
+
+    mutable std::atomic<std::uint64_t> __warm_attempts{0}; //!< 热启动尝试次数
+    mutable std::atomic<std::uint64_t> __warm_hits{0};     //!< 热启动成功次数
+    mutable std::atomic<std::uint64_t> __iterations{0};    //!< 热启动累计迭代次数
+    mutable std::atomic<std::uint64_t> __full_solves{0};   //!< 完整解算次数
+};
+
+using QuadPoseSolver_ptr = std::shared_ptr<QuadPoseSolver>; //!< 四边形位姿解算器智能指针类型
@@ -0,0 +1,499 @@
+#include "vis_core/utils/pose_solver/quad_pose_solver.h"
+
+#include <cmath>
+
+using namespace std;
+using namespace cv;
+
+namespace
+{
+    //! 归一化相机坐标下的四边形角点
+    using NormalizedCorners = array<Point2d, 4>;
+
+    //! 角点去畸变并转换为归一化相机坐标
+    NormalizedCorners normalizeCorners(const CameraWrapper &camera, const QuadPoseSolver::Corners &corners)
+    {
+        NormalizedCorners image;
+        for (int i = 0; i < 4; ++i)
+            image[i] = camera.lookupNormalized(Point2d(corners[i]));
+        return image;
+    }
+
+    /**
+     * @brief 求解 N 元线性方程组 (列主元高斯消元)
+     *
+     * @param[in,out] a 增广矩阵 [A | b]，求解成功后最后一列为解
+     * @return 系数矩阵是否可逆
+     */
+    template <int N>
+    bool solveLinear(Matx<double, N, N + 1> &a) noexcept
+    {
+        for (int col = 0; col < N; ++col)
+        {
+            int pivot = col;
+            for (int row = col + 1; row < N; ++row)
+                if (std::abs(a(row, col)) > std::abs(a(pivot, col)))
+                    pivot = row;
+            if (std::abs(a(pivot, col)) < 1e-15)
+                return false;
+            if (pivot != col)
+                for (int j = col; j <= N; ++j)
+                    std::swap(a(col, j), a(pivot, j));
+            for (int row = col + 1; row < N; ++row)
+            {
+                const double factor = a(row, col) / a(col, col);
+                for (int j = col; j <= N; ++j)
+                    a(row, j) -= factor * a(col, j);
+            }
+        }
+        for (int row = N - 1; row >= 0; --row)
+        {
+            double value = a(row, N);
+            for (int j = row + 1; j < N; ++j)
+                value -= a(row, j) * a(j, N);
+            a(row, N) = value / a(row, row);
+        }
+        return true;
+    }
+
+    /**
+     * @brief 单位正方形 (0,0) (1,0) (1,1) (0,1) 到四边形的单应矩阵 (Heckbert 闭式解)
+     *
+     * @return 四边形是否退化
+     */
+    bool squareToQuad(const NormalizedCorners &q, Matx33d &H) noexcept
+    {
+        const double dx1 = q[1].x - q[2].x, dx2 = q[3].x - q[2].x, sx = q[0].x - q[1].x + q[2].x - q[3].x;
+        const double dy1 = q[1].y - q[2].y, dy2 = q[3].y - q[2].y, sy = q[0].y - q[1].y + q[2].y - q[3].y;
+        const double den = dx1 * dy2 - dx2 * dy1;
+        if (std::abs(den) < 1e-15)
+            return false;
+        const double g = (sx * dy2 - dx2 * sy) / den;
+        const double h = (dx1 * sy - sx * dy1) / den;
+        H = Matx33d(q[1].x - q[0].x + g * q[1].x, q[3].x - q[0].x + h * q[3].x, q[0].x,
+                    q[1].y - q[0].y + g * q[1].y, q[3].y - q[0].y + h * q[3].y, q[0].y,
+                    g, h, 1);
+        return true;
+    }
+
+    /**
+     * @brief IPPE：由模型平面到归一化像平面的单应矩阵计算平面位姿的两个候选旋转
+     *
+     * @param[in] H 单应矩阵，须满足 H(2,2) = 1 且模型以原点为中心
+     * @param[out] R1 候选旋转 1
+     * @param[out] R2 候选旋转 2
+     *
+     * @note 参考 Collins & Bartoli, "Infinitesimal Plane-based Pose Estimation", IJCV 2014
+     */
+    void ippeRotations(const Matx33d &H, Matx33d &R1, Matx33d &R2) noexcept
+    {
+        // 模型原点的像点 (p, q) 与该处单应变换的雅可比矩阵 J
+        const double p = H(0, 2), q = H(1, 2);
+        const double j00 = H(0, 0) - H(2, 0) * p, j01 = H(0, 1) - H(2, 1) * p;
+        const double j10 = H(1, 0) - H(2, 0) * q, j11 = H(1, 1) - H(2, 1) * q;
+
+        // Rv：将 z 轴旋转至视线方向 (p, q, 1) 的旋转
+        const double inv_norm = 1.0 / std::sqrt(p * p + q * q + 1);
+        const double a = p * inv_norm, b = q * inv_norm, c = inv_norm;
+        const double k = 1.0 / (1.0 + c);
+        const Matx33d Rv(1 - a * a * k, -a * b * k, a,
+                         -a * b * k, 1 - b * b * k, b,
+                         -a, -b, c);
+
+        // B = ([I | -(p, q)] * Rv) 的前两列，A = B^-1 * J
+        const double b00 = Rv(0, 0) - p * Rv(2, 0), b01 = Rv(0, 1) - p * Rv(2, 1);
+        const double b10 = Rv(1, 0) - q * Rv(2, 0), b11 = Rv(1, 1) - q * Rv(2, 1);
+        const double inv_det = 1.0 / (b00 * b11 - b01 * b10);
+        const double a00 = inv_det * (b11 * j00 - b01 * j10), a01 = inv_det * (b11 * j01 - b01 * j11);
+        const double a10 = inv_det * (b00 * j10 - b10 * j00), a11 = inv_det * (b00 * j11 - b10 * j01);
+
+        // A 的最大奇异值即尺度，A / gamma 为旋转矩阵 (在 Rv 坐标系下) 的左上 2x2 块
+        const double ata00 = a00 * a00 + a10 * a10, ata01 = a00 * a01 + a10 * a11, ata11 = a01 * a01 + a11 * a11;
+        const double gamma = std::sqrt(0.5 * (ata00 + ata11 + std::sqrt((ata00 - ata11) * (ata00 - ata11) + 4 * ata01 * ata01)));
+        const double m00 = a00 / gamma, m01 = a01 / gamma, m10 = a10 / gamma, m11 = a11 / gamma;
+
+        // 由列向量单位正交补全第三行，符号的两种选择对应两个候选解
+        const double c0 = std::sqrt(std::max(0.0, 1 - m00 * m00 - m10 * m10));
+        double c1 = std::sqrt(std::max(0.0, 1 - m01 * m01 - m11 * m11));
+        if (m00 * m01 + m10 * m11 > 0)
+            c1 = -c1;
+        const auto complete = [&](double sign)
+        {
+            const Vec3d col0(m00, m10, sign * c0), col1(m01, m11, sign * c1);
+            const Vec3d col2 = col0.cross(col1);
+            return Rv * Matx33d(col0(0), col1(0), col2(0),
+                                col0(1), col1(1), col2(1),
+                                col0(2), col1(2), col2(2));
+        };
+        R1 = complete(1);
+        R2 = complete(-1);
+    }
+
+    /**
+     * @brief 已知旋转时以线性最小二乘求解平移
+     *
+     * @return 是否求解成功
+     */
+    bool solveTranslation(const array<Point3d, 4> &model, const NormalizedCorners &image, const Matx33d &R, Vec3d &t) noexcept
+    {
+        // 每个点贡献两个方程：t_x - u t_z = u P_z - P_x，t_y - v t_z = v P_z - P_y
+        Matx<double, 3, 4> normal = Matx<double, 3, 4>::zeros();
+        for (int i = 0; i < 4; ++i)
+        {
+            const Vec3d P = R * Vec3d(model[i].x, model[i].y, model[i].z);
+            const double u = image[i].x, v = image[i].y;
+            const double rows[2][4] = {{1, 0, -u, u * P(2) - P(0)},
+                                       {0, 1, -v, v * P(2) - P(1)}};
+            for (const auto &row : rows)
+                for (int r = 0; r < 3; ++r)
+                    for (int c = 0; c < 4; ++c)
+                        normal(r, c) += row[r] * row[c];
+        }
+        if (!solveLinear<3>(normal))
+            return false;
+        t = Vec3d(normal(0, 3), normal(1, 3), normal(2, 3));
+        return true;
+    }
+
+    /**
+     * @brief 计算归一化坐标下的重投影误差平方和
+     *
+     * @return 误差平方和，点位于相机后方时返回无穷大
+     */
+    double reprojectionError(const array<Point3d, 4> &model, const NormalizedCorners &image, const Matx33d &R, const Vec3d &t) noexcept
+    {
+        double error = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const Vec3d P = R * Vec3d(model[i].x, model[i].y, model[i].z) + t;
+            if (P(2) <= 0)
+                return numeric_limits<double>::infinity();
+            const double dx = P(0) / P(2) - image[i].x, dy = P(1) / P(2) - image[i].y;
+            error += dx * dx + dy * dy;
+        }
+        return error;
+    }
+
+    /**
+     * @brief 重投影误差的法方程 J^T J dx = -J^T r
+     *
+     * @note 未知量依次为旋转小量 w 与平移增量，旋转以左乘 exp([w]x) 更新
+     */
+    struct NormalEquations
+    {
+        double A[6][6]; //!< J^T J
+        double b[6];    //!< -J^T r
+        double error;   //!< 误差平方和
+    };
+
+    /**
+     * @brief 在当前位姿处构建法方程
+     *
+     * @return 是否构建成功，点位于相机后方时失败
+     */
+    bool buildNormalEquations(const array<Point3d, 4> &model, const NormalizedCorners &image, const Matx33d &R, const Vec3d &t,
+                              NormalEquations &normal) noexcept
+    {
+        // 局部累加上三角部分，最后对称填充
+        double A[21] = {}, b[6] = {}, error = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const Vec3d RX = R * Vec3d(model[i].x, model[i].y, model[i].z);
+            const Vec3d P = RX + t;
+            if (P(2) <= 0)
+                return false;
+            const double inv_z = 1.0 / P(2);
+            const double u = P(0) * inv_z, v = P(1) * inv_z;
+            const double ru = u - image[i].x, rv = v - image[i].y;
+            // d(proj)/dP = [1/z, 0, -u/z; 0, 1/z, -v/z]，dP/dw = -[RX]x，dP/dt = I
+            const double ju[6] = {-u * inv_z * RX(1), inv_z * (RX(2) + u * RX(0)), -inv_z * RX(1), inv_z, 0, -u * inv_z};
+            const double jv[6] = {-inv_z * (RX(2) + v * RX(1)), v * inv_z * RX(0), inv_z * RX(0), 0, inv_z, -v * inv_z};
+            for (int r = 0, k = 0; r < 6; ++r)
+            {
+                for (int c = r; c < 6; ++c, ++k)
+                    A[k] += ju[r] * ju[c] + jv[r] * jv[c];
+                b[r] -= ju[r] * ru + jv[r] * rv;
+            }
+            error += ru * ru + rv * rv;
+        }
+        for (int r = 0, k = 0; r < 6; ++r)
+        {
+            for (int c = r; c < 6; ++c, ++k)
+                normal.A[r][c] = normal.A[c][r] = A[k];
+            normal.b[r] = b[r];
+        }
+        normal.error = error;
+        return true;
+    }
+
+    /**
+     * @brief 以 LDL^T 分解求解 (J^T J + lambda diag(J^T J)) dx = -J^T r
+     *
+     * @return 阻尼后的系数矩阵是否正定
+     *
+     * @note 每列只做一次除法，避免开方与逐元素除法的长依赖链
+     */
+    bool solveNormalEquations(const NormalEquations &normal, double lambda, double dx[6]) noexcept
+    {
+        double L[6][6], D[6], inv_D[6];
+        for (int j = 0; j < 6; ++j)
+        {
+            double d = normal.A[j][j] * (1 + lambda);
+            for (int k = 0; k < j; ++k)
+                d -= L[j][k] * L[j][k] * D[k];
+            if (d <= 1e-30)
+                return false;
+            D[j] = d;
+            inv_D[j] = 1.0 / d;
+            for (int i = j + 1; i < 6; ++i)
+            {
+                double sum = normal.A[i][j];
+                for (int k = 0; k < j; ++k)
+                    sum -= L[i][k] * L[j][k] * D[k];
+                L[i][j] = sum * inv_D[j];
+            }
+        }
+        double y[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            double sum = normal.b[i];
+            for (int k = 0; k < i; ++k)
+                sum -= L[i][k] * y[k];
+            y[i] = sum;
+        }
+        for (int i = 5; i >= 0; --i)
+        {
+            double sum = y[i] * inv_D[i];
+            for (int k = i + 1; k < 6; ++k)
+                sum -= L[k][i] * dx[k];
+            dx[i] = sum;
+        }
+        return true;
+    }
+
+    //! 将增量应用到位姿上
+    void applyUpdate(const double dx[6], Matx33d &R, Vec3d &t) noexcept
+    {
+        R = transform6D_utils::quatToRmat(transform6D_utils::rvecToQuat(Vec3d(dx[0], dx[1], dx[2]))) * R;
+        t += Vec3d(dx[3], dx[4], dx[5]);
+    }
+
+    /**
+     * @brief Gauss-Newton 优化重投影误差
+     */
+    void refinePose(const array<Point3d, 4> &model, const NormalizedCorners &image, int iterations, Matx33d &R, Vec3d &t) noexcept
+    {
+        for (int iter = 0; iter < iterations; ++iter)
+        {
+            NormalEquations normal;
+            double dx[6];
+            if (!buildNormalEquations(model, image, R, t, normal) || !solveNormalEquations(normal, 0, dx))
+                return;
+            applyUpdate(dx, R, t);
+        }
+    }
+
+    /**
+     * @brief Levenberg-Marquardt 优化重投影误差
+     *
+     * @param[in] iterations 最大迭代次数
+     * @param[in,out] R 旋转矩阵，输入为初值
+     * @param[in,out] t 平移向量，输入为初值
+     * @param[out] used 实际执行的迭代次数
+     * @return 优化后的误差平方和，初值不合法 (点位于相机后方) 时返回无穷大
+     *
+     * @note - 候选位姿先只计算误差，确定继续迭代时才构建法方程
+     *
+     *       - 更新量足够小 (二阶余项可忽略) 或误差下降不足 1% 时视为收敛
+     */
+    double levenbergMarquardt(const array<Point3d, 4> &model, const NormalizedCorners &image, int iterations,
+                              Matx33d &R, Vec3d &t, int &used) noexcept
+    {
+        used = 0;
+        NormalEquations normal;
+        if (!buildNormalEquations(model, image, R, t, normal))
+            return numeric_limits<double>::infinity();
+        double error = normal.error;
+        double lambda = 1e-3;
+        while (used < iterations)
+        {
+            ++used;
+            double dx[6];
+            if (!solveNormalEquations(normal, lambda, dx))
+                break;
+
+            Matx33d R_candidate = R;
+            Vec3d t_candidate = t;
+            applyUpdate(dx, R_candidate, t_candidate);
+            const double candidate_error = reprojectionError(model, image, R_candidate, t_candidate);
+            if (candidate_error >= error)
+            {
+                lambda *= 10;
+                continue;
+            }
+            const double inv_depth = 1.0 / t_candidate(2);
+            const double step = dx[0] * dx[0] + dx[1] * dx[1] + dx[2] * dx[2] +
+                                (dx[3] * dx[3] + dx[4] * dx[4] + dx[5] * dx[5]) * inv_depth * inv_depth;
+            const bool converged = step < 1e-4 || error - candidate_error <= 1e-2 * error;
+            R = R_candidate;
+            t = t_candidate;
+            error = candidate_error;
+            lambda *= 0.1;
+            if (converged || used == iterations || !buildNormalEquations(model, image, R, t, normal))
+                break;
+        }
+        return error;
+    }
+}
+
+QuadPoseSolver::QuadPoseSolver(const CameraWrapper_ptr &camera, double width, double height)
+    : __camera(camera)
+{
+    if (!__camera)
+        VISCORE_THROW_ERROR("QuadPoseSolver : 相机为空");
+    if (width <= 0 || height <= 0)
+        VISCORE_THROW_ERROR("QuadPoseSolver : 四边形模型尺寸无效 (%f x %f)", width, height);
+
+    const double hw = 0.5 * width, hh = 0.5 * height;
+    __model_points = {Point3d(-hw, -hh, 0), Point3d(hw, -hh, 0), Point3d(hw, hh, 0), Point3d(-hw, hh, 0)};
+    // 模型平面 (x, y) 到单位正方形 (x / width + 1/2, y / height + 1/2)
+    __model_to_square = Matx33d(1.0 / width, 0, 0.5,
+                                0, 1.0 / height, 0.5,
+                                0, 0, 1);
+    const auto &K = __camera->cameraMatrix();
+    __focal = 0.5 * (K(0, 0) + K(1, 1));
+}
+
+QuadPoseSolver::Result QuadPoseSolver::solve(const Corners &corners) const
+{
+    __full_solves.fetch_add(1, memory_order_relaxed);
+    Result result;
+    const NormalizedCorners image = normalizeCorners(*__camera, corners);
+
+    // 模型平面到归一化像平面的单应矩阵
+    Matx33d H_square;
+    if (!squareToQuad(image, H_square))
+        return result;
+    Matx33d H = H_square * __model_to_square;
+    if (std::abs(H(2, 2)) < 1e-15)
+        return result;
+    H *= 1.0 / H(2, 2);
+
+    // 两个候选解中选取重投影误差较小者
+    Matx33d R1, R2;
+    ippeRotations(H, R1, R2);
+    Vec3d t1, t2;
+    const double error1 = solveTranslation(__model_points, image, R1, t1) ? reprojectionError(__model_points, image, R1, t1)
+                                                                          : numeric_limits<double>::infinity();
+    const double error2 = solveTranslation(__model_points, image, R2, t2) ? reprojectionError(__model_points, image, R2, t2)
+                                                                          : numeric_limits<double>::infinity();
+    Matx33d R = error1 <= error2 ? R1 : R2;
+    Vec3d t = error1 <= error2 ? t1 : t2;
+    double error = std::min(error1, error2);
+    if (!std::isfinite(error))
+        return result;
+
+    const int iterations = getRefineIterations();
+    if (iterations > 0)
+    {
+        Matx33d R_refined = R;
+        Vec3d t_refined = t;
+        refinePose(__model_points, image, iterations, R_refined, t_refined);
+        const double refined_error = reprojectionError(__model_points, image, R_refined, t_refined);
+        if (refined_error < error)
+        {
+            R = R_refined;
+            t = t_refined;
+            error = refined_error;
+        }
+    }
+
+    result.camera_to_feature = Transform6D(R, t);
+    result.rms_error = std::sqrt(error / 4) * __focal;
+    result.valid = true;
+    return result;
+}
+
+QuadPoseSolver::Result QuadPoseSolver::refine(const Corners &corners, const Transform6D &initial) const
+{
+    Result result;
+    result.warm_started = true;
+    const NormalizedCorners image = normalizeCorners(*__camera, corners);
+
+    Matx33d R = initial.rmat();
+    Vec3d t = initial.tvec();
+    const double error = levenbergMarquardt(__model_points, image, getWarmIterations(), R, t, result.iterations);
+
+    __warm_attempts.fetch_add(1, memory_order_relaxed);
+    __iterations.fetch_add(result.iterations, memory_order_relaxed);
+    if (!std::isfinite(error))
+        return result;
+    result.camera_to_feature = Transform6D(R, t);
+    result.rms_error = std::sqrt(error / 4) * __focal;
+    result.valid = result.rms_error <= getWarmMaxError();
+    if (result.valid)
+        __warm_hits.fetch_add(1, memory_order_relaxed);
+    return result;
+}
+
+void QuadPoseSolver::solve(span<const Corners> corners, span<Result> results) const
+{
+    if (corners.size() != results.size())
+        VISCORE_THROW_ERROR("QuadPoseSolver : 角点组数量 (%zu) 与结果数量 (%zu) 不一致", corners.size(), results.size());
+    for (size_t i = 0; i < corners.size(); ++i)
+        results[i] = solve(corners[i]);
+}
+
+size_t QuadPoseSolver::solve(span<const QuadrilateralBase_ptr> features) const
+{
+    const FrameId camera_frame = getCameraFrame();
+    const bool warm_start = getWarmStart();
+    size_t solved = 0;
+    for (const auto &feature : features)
+    {
+        if (!feature)
+            continue;
+        auto corners = feature->imageCache().tryGetCorners();
+        if (!corners || corners->size() != 4)
+            continue;
+        const Corners quad{(*corners)[0], (*corners)[1], (*corners)[2], (*corners)[3]};
+
+        auto &pose_cache = feature->getPoseCache();
+        Result result;
+        if (warm_start && pose_cache.isSetPoseNodes())
+        {
+            const auto &nodes = pose_cache.getPoseNodes();
+            auto previous = nodes.find(camera_frame);
+            if (previous != nodes.end())
+                result = refine(quad, previous->second);
+        }
+        if (!result.valid)
+            result = solve(quad);
+        if (!result.valid)
+            continue;
+
+        if (!pose_cache.isSetPoseNodes())
+            pose_cache.setPoseNodes(FeatureNode::PoseCache::PoseNodeMap());
+        pose_cache.getPoseNodes().insert_or_assign(camera_frame, result.camera_to_feature);
+        ++solved;
+    }
+    return solved;
+}
+
+QuadPoseSolver::Statistics QuadPoseSolver::statistics() const noexcept
+{
+    Statistics stats;
+    stats.warm_attempts = __warm_attempts.load(memory_order_relaxed);
+    stats.warm_hits = __warm_hits.load(memory_order_relaxed);
+    stats.iterations = __iterations.load(memory_order_relaxed);
+    stats.full_solves = __full_solves.load(memory_order_relaxed);
+    return stats;
+}
+
+void QuadPoseSolver::resetStatistics() noexcept
+{
+    __warm_attempts.store(0, memory_order_relaxed);
+    __warm_hits.store(0, memory_order_relaxed);
+    __iterations.store(0, memory_order_relaxed);
+    __full_solves.store(0, memory_order_relaxed);
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+/**
+ * @class ContourHierarchy
+ * @brief 扁平的轮廓层级结构
+ *
+ * 1. 以轮廓序号代替轮廓指针，节点连续存放，与轮廓序列一一对应
+ * 2. 构建时一次性计算每个轮廓的深度与子轮廓数量
+ * 3. 提供子轮廓遍历、深度优先遍历与同深度轮廓查询
+ *
+ * @note - 节点序号与 findContours 输出的轮廓序号一致，不存在的关联以 npos 表示
+ *
+ *       - 深度以顶层轮廓为 0，逐层加 1
+ */
+class ContourHierarchy
+{
+public:
+    static constexpr int npos = -1; //!< 无效序号
+
+    /**
+     * @brief 层级节点
+     */
+    struct Node
+    {
+        int next = npos;      //!< 后一个同级轮廓
+        int prev = npos;      //!< 前一个同级轮廓
+        int child = npos;     //!< 第一个子轮廓
+        int parent = npos;    //!< 父轮廓
+        int depth = 0;        //!< 轮廓深度
+        int child_count = 0;  //!< 直接子轮廓数量
+    };
+
+    /**
+     * @class SiblingIterator
+     * @brief 沿同级链表前进的迭代器，解引用得到轮廓序号
+     */
+    class SiblingIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int *;
+        using reference = int;
+
+        SiblingIterator() = default;
+        SiblingIterator(const std::vector<Node> *nodes, int index) : __nodes(nodes), __index(index) {}
+
+        int operator*() const { return __index; }
+        SiblingIterator &operator++()
+        {
+            __index = (*__nodes)[__index].next;
+            return *this;
+        }
+        SiblingIterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        bool operator==(const SiblingIterator &other) const { return __index == other.__index; }
+
+    private:
+        const std::vector<Node> *__nodes = nullptr; //!< 层级节点
+        int __index = npos;                         //!< 当前轮廓序号
+    };
+
+    /**
+     * @class DepthFirstIterator
+     * @brief 先序深度优先遍历迭代器，不使用辅助栈，解引用得到轮廓序号
+     */
+    class DepthFirstIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int *;
+        using reference = int;
+
+        DepthFirstIterator() = default;
+        DepthFirstIterator(const std::vector<Node> *nodes, int index, int root)
+            : __nodes(nodes), __index(index), __root(root) {}
+
+        int operator*() const { return __index; }
+        DepthFirstIterator &operator++()
+        {
+            const auto &nodes = *__nodes;
+            if (nodes[__index].child != npos)
+            {
+                __index = nodes[__index].child;
+                return *this;
+            }
+            // 回溯至存在后继同级轮廓的祖先，越过子树根节点即结束
+            int current = __index;
+            while (current != __root && nodes[current].next == npos)
+            {
+                current = nodes[current].parent;
+                if (current == npos)
+                {
+                    __index = npos;
+                    return *this;
+                }
+            }
+            __index = (current == __root) ? npos : nodes[current].next;
+            return *this;
+        }
+        DepthFirstIterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        bool operator==(const DepthFirstIterator &other) const { return __index == other.__index; }
+
+    private:
+        const std::vector<Node> *__nodes = nullptr; //!< 层级节点
+        int __index = npos;                         //!< 当前轮廓序号
+        int __root = npos;                          //!< 子树根节点，npos 表示遍历整个森林
+    };
+
+    /**
+     * @brief 迭代器区间
+     */
+    template <typename Iter>
+    struct Range
+    {
+        Iter first;
+        Iter last;
+        Iter begin() const { return first; }
+        Iter end() const { return last; }
+    };
+
+    /**
+     * @brief 默认构造函数，构造空层级
+     */
+    ContourHierarchy() = default;
+
+    /**
+     * @brief 构造函数
+     *
+     * @param[in] hierarchy cv::findContours 输出的层级信息 [后一个轮廓, 前一个轮廓, 内嵌轮廓, 父轮廓]
+     */
+    explicit ContourHierarchy(const std::vector<cv::Vec4i> &hierarchy) { assign(hierarchy); }
+
+    /**
+     * @brief 由 cv::findContours 输出的层级信息重新构建
+     *
+     * @param[in] hierarchy cv::findContours 输出的层级信息 [后一个轮廓, 前一个轮廓, 内嵌轮廓, 父轮廓]
+     */
+    void assign(const std::vector<cv::Vec4i> &hierarchy)
+    {
+        __nodes.resize(hierarchy.size());
+        for (size_t i = 0; i < hierarchy.size(); ++i)
+        {
+            const auto &h = hierarchy[i];
+            __nodes[i] = {h[0], h[1], h[2], h[3], 0, 0};
+        }
+        __first_root = npos;
+        for (size_t i = 0; i < __nodes.size(); ++i)
+        {
+            const auto &node = __nodes[i];
+            if (node.parent == npos && node.prev == npos)
+            {
+                __first_root = static_cast<int>(i);
+                break;
+            }
+        }
+        // 先序遍历保证父轮廓先于子轮廓被访问
+        for (int index : depthFirst())
+        {
+            auto &node = __nodes[index];
+            if (node.parent != npos)
+            {
+                node.depth = __nodes[node.parent].depth + 1;
+                ++__nodes[node.parent].child_count;
+            }
+        }
+    }
+
+    /**
+     * @brief 清空层级
+     */
+    void clear() noexcept
+    {
+        __nodes.clear();
+        __first_root = npos;
+    }
+
+    //----------------[节点访问接口]-------------------------
+
+    size_t size() const noexcept { return __nodes.size(); }
+    bool empty() const noexcept { return __nodes.empty(); }
+    const Node &operator[](int index) const { return __nodes[index]; }
+    const std::vector<Node> &nodes() const noexcept { return __nodes; }
+
+    int next(int index) const { return __nodes[index].next; }
+    int prev(int index) const { return __nodes[index].prev; }
+    int firstChild(int index) const { return __nodes[index].child; }
+    int parent(int index) const { return __nodes[index].parent; }
+    int depth(int index) const { return __nodes[index].depth; }
+    int childCount(int index) const { return __nodes[index].child_count; }
+
+    //----------------[遍历接口]-------------------------
+
+    /**
+     * @brief 顶层轮廓
+     */
+    Range<SiblingIterator> roots() const
+    {
+        return {SiblingIterator(&__nodes, __first_root), SiblingIterator(&__nodes, npos)};
+    }
+
+    /**
+     * @brief 指定轮廓的直接子轮廓
+     *
+     * @param[in] index 轮廓序号
+     */
+    Range<SiblingIterator> children(int index) const
+    {
+        return {SiblingIterator(&__nodes, __nodes[index].child), SiblingIterator(&__nodes, npos)};
+    }
+
+    /**
+     * @brief 先序深度优先遍历
+     *
+     * @param[in] root 子树根节点 (包含自身)，npos 表示遍历所有轮廓
+     */
+    Range<DepthFirstIterator> depthFirst(int root = npos) const
+    {
+        const int first = (root == npos) ? __first_root : root;
+        return {DepthFirstIterator(&__nodes, first, root), DepthFirstIterator(&__nodes, npos, root)};
+    }
+
+    /**
+     * @brief 获取指定深度的全部轮廓
+     *
+     * @param[in] depth 轮廓深度
+     * @param[out] indices 轮廓序号 (清空后按序号升序写入)
+     */
+    void atDepth(int depth, std::vector<int> &indices) const
+    {
+        select([depth](const Node &node)
+               { return node.depth == depth; },
+               indices);
+    }
+
+    /**
+     * @brief 线性扫描所有节点，筛选满足条件的轮廓
+     *
+     * @param[in] pred 谓词，参数为 const Node &
+     * @param[out] indices 轮廓序号 (清空后按序号升序写入)
+     *
+     * @code {.cpp}
+     * // 恰好包含一个内嵌轮廓的轮廓
+     * hierarchy.select([](const ContourHierarchy::Node &node) { return node.child_count == 1; }, indices);
+     * @endcode
+     */
+    template <typename Pred>
+    void select(Pred &&pred, std::vector<int> &indices) const
+    {
+        indices.clear();
+        for (size_t i = 0; i < __nodes.size(); ++i)
+        {
+            if (pred(__nodes[i]))
+                indices.push_back(static_cast<int>(i));
+        }
+    }
+
+private:
+    std::vector<Node> __nodes; //!< 层级节点，与轮廓序号一一对应
+    int __first_root = npos;   //!< 第一个顶层轮廓
+};
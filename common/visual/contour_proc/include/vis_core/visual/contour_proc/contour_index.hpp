@@ -0,0 +1,632 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "contour_wrapper.hpp"
+
+/**
+ * @class ContourSpatialIndex
+ * @brief 单帧轮廓的空间索引，用于快速的邻域查询与轮廓配对
+ *
+ * 1. 基于轮廓缓存的包围盒与质心一次性构建，构建后只读，可被多个线程并发查询
+ * 2. 稠密帧使用均匀网格，稀疏帧使用 STR 打包的 R 树
+ * 3. 支持 k 近邻、半径与包围盒重叠查询，结果为轮廓在输入序列中的索引或轮廓指针
+ *
+ * @note - 距离类查询(k 近邻、半径)以轮廓质心为准，重叠查询以轮廓包围盒为准
+ *
+ *       - 质心不在包围盒内时 (如面积为 0 的退化轮廓) 以包围盒中心代替质心
+ *
+ *       - 网格为距离类查询按质心分桶，为重叠查询按包围盒中心另行分桶
+ *
+ *       - 索引持有输入轮廓组的副本 (轮廓指针)，输入轮廓组可在构建后释放
+ */
+template <ContourWrapperBaseType _Tp = int>
+class ContourSpatialIndex
+{
+public:
+    using ContourPtr = ContourT_ptr<_Tp>;     //!< 轮廓指针类型
+    using ContourGroup = std::vector<ContourPtr>; //!< 轮廓组类型
+
+    /**
+     * @brief 索引后端
+     */
+    enum class Backend
+    {
+        Auto,  //!< 根据轮廓数量与尺寸分布自动选择
+        Grid,  //!< 均匀网格
+        RTree, //!< STR 打包 R 树
+    };
+
+private:
+    /**
+     * @brief 索引条目
+     */
+    struct Entry
+    {
+        cv::Rect2f box;       //!< 轮廓包围盒
+        cv::Point2f center;   //!< 轮廓质心 (不在包围盒内时为包围盒中心)
+        std::uint32_t index;  //!< 轮廓在输入序列中的序号
+    };
+
+    /**
+     * @brief R 树节点
+     *
+     * @note 叶节点的 [first, first + count) 指向 __entries，内部节点指向 __nodes
+     */
+    struct Node
+    {
+        cv::Rect2f box;      //!< 子树包围盒
+        std::uint32_t first; //!< 首个子项序号
+        std::uint32_t count; //!< 子项数量
+        bool leaf;           //!< 是否为叶节点
+    };
+
+    static constexpr std::uint32_t RTreeFanout = 16;   //!< R 树节点扇出
+    static constexpr size_t GridMinCount = 64;         //!< 采用网格所需的最少轮廓数
+    static constexpr float GridMaxBoxRatio = 4.f;      //!< 采用网格时包围盒边长与网格边长的最大比值
+
+public:
+    /**
+     * @brief 默认构造函数，构造空索引
+     */
+    ContourSpatialIndex() = default;
+
+    /**
+     * @brief 构造函数
+     *
+     * @param[in] contours 轮廓组
+     * @param[in] backend 索引后端
+     */
+    explicit ContourSpatialIndex(const ContourGroup &contours, Backend backend = Backend::Auto)
+    {
+        build(contours, backend);
+    }
+
+    /**
+     * @brief 重新构建索引
+     *
+     * @param[in] contours 轮廓组
+     * @param[in] backend 索引后端
+     *
+     * @note 会复用已有的内部缓冲区，逐帧重建时不产生额外的内存分配
+     */
+    void build(const ContourGroup &contours, Backend backend = Backend::Auto)
+    {
+        __contours = contours;
+        __entries.clear();
+        __nodes.clear();
+        __cell_start.clear();
+        __cell_items.clear();
+        __box_cell_start.clear();
+        __box_cell_items.clear();
+        __max_half_size = cv::Size2f(0.f, 0.f);
+
+        __entries.reserve(contours.size());
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            const auto &contour = contours[i];
+            const cv::Rect2f box(contour->boundingRect());
+            const auto centroid = contour->center();
+            cv::Point2f center(static_cast<float>(centroid.x), static_cast<float>(centroid.y));
+            if (!(center.x >= box.x && center.x <= box.x + box.width && center.y >= box.y && center.y <= box.y + box.height))
+                center = boxCenter(box);
+            __entries.push_back({box, center, static_cast<std::uint32_t>(i)});
+        }
+
+        if (__entries.empty())
+        {
+            __backend = Backend::Grid;
+            return;
+        }
+
+        // 统计全局范围与包围盒尺寸
+        float min_x = std::numeric_limits<float>::max(), min_y = std::numeric_limits<float>::max();
+        float max_x = std::numeric_limits<float>::lowest(), max_y = std::numeric_limits<float>::lowest();
+        for (const auto &entry : __entries)
+        {
+            min_x = std::min(min_x, entry.box.x);
+            min_y = std::min(min_y, entry.box.y);
+            max_x = std::max(max_x, entry.box.x + entry.box.width);
+            max_y = std::max(max_y, entry.box.y + entry.box.height);
+            __max_half_size.width = std::max(__max_half_size.width, 0.5f * entry.box.width);
+            __max_half_size.height = std::max(__max_half_size.height, 0.5f * entry.box.height);
+        }
+        __extent = cv::Rect2f(min_x, min_y, std::max(max_x - min_x, 1.f), std::max(max_y - min_y, 1.f));
+
+        // 网格边长：平均每个网格约含一个轮廓
+        __cell_size = std::max(1.f, std::sqrt(__extent.area() / static_cast<float>(__entries.size())));
+
+        if (backend == Backend::Auto)
+        {
+            const float max_box_size = 2.f * std::max(__max_half_size.width, __max_half_size.height);
+            backend = (__entries.size() >= GridMinCount && max_box_size <= GridMaxBoxRatio * __cell_size)
+                          ? Backend::Grid
+                          : Backend::RTree;
+        }
+        __backend = backend;
+
+        if (__backend == Backend::Grid)
+            buildGrid();
+        else
+            buildRTree();
+    }
+
+    /**
+     * @brief 获取当前使用的索引后端
+     */
+    Backend backend() const noexcept { return __backend; }
+
+    /**
+     * @brief 获取已索引的轮廓数量
+     */
+    size_t size() const noexcept { return __entries.size(); }
+
+    /**
+     * @brief 判断索引是否为空
+     */
+    bool empty() const noexcept { return __entries.empty(); }
+
+    //----------------[索引查询接口]-------------------------
+
+    /**
+     * @brief 半径查询：质心到 center 的距离不超过 radius 的轮廓
+     *
+     * @param[in] center 查询中心
+     * @param[in] radius 查询半径
+     * @param[out] indices 轮廓在输入序列中的序号 (追加写入，顺序不定)
+     */
+    void radiusSearch(const cv::Point2f &center, float radius, std::vector<size_t> &indices) const
+    {
+        if (__entries.empty() || radius < 0.f)
+            return;
+
+        const float radius2 = radius * radius;
+        auto visit = [&](const Entry &entry)
+        {
+            if (squaredDistance(entry.center, center) <= radius2)
+                indices.push_back(entry.index);
+        };
+
+        if (__backend == Backend::Grid)
+        {
+            forEachCellEntry(cv::Rect2f(center.x - radius, center.y - radius, 2.f * radius, 2.f * radius),
+                             __cell_start, __cell_items, visit);
+        }
+        else
+        {
+            forEachRTreeEntry([&](const cv::Rect2f &box)
+                              { return squaredDistance(box, center) <= radius2; },
+                              visit);
+        }
+    }
+
+    /**
+     * @brief 包围盒重叠查询：包围盒与 box 相交的轮廓
+     *
+     * @param[in] box 查询区域
+     * @param[out] indices 轮廓在输入序列中的序号 (追加写入，顺序不定)
+     */
+    void boxSearch(const cv::Rect2f &box, std::vector<size_t> &indices) const
+    {
+        if (__entries.empty())
+            return;
+
+        auto visit = [&](const Entry &entry)
+        {
+            if (overlaps(entry.box, box))
+                indices.push_back(entry.index);
+        };
+
+        if (__backend == Backend::Grid)
+        {
+            // 条目按包围盒中心落入网格，包围盒与查询区域相交时其中心必位于按最大半宽、半高扩展后的区域内
+            const cv::Rect2f expanded(box.x - __max_half_size.width, box.y - __max_half_size.height,
+                                      box.width + 2.f * __max_half_size.width, box.height + 2.f * __max_half_size.height);
+            forEachCellEntry(expanded, __box_cell_start, __box_cell_items, visit);
+        }
+        else
+        {
+            forEachRTreeEntry([&](const cv::Rect2f &node_box)
+                              { return overlaps(node_box, box); },
+                              visit);
+        }
+    }
+
+    /**
+     * @brief k 近邻查询：质心距离 center 最近的 k 个轮廓
+     *
+     * @param[in] center 查询中心
+     * @param[in] k 近邻数量
+     * @param[out] indices 轮廓在输入序列中的序号 (清空后写入，按距离由近到远排列)
+     */
+    void knnSearch(const cv::Point2f &center, size_t k, std::vector<size_t> &indices) const
+    {
+        indices.clear();
+        if (__entries.empty() || k == 0)
+            return;
+        k = std::min(k, __entries.size());
+
+        // 大顶堆保存当前最近的 k 个 (距离平方, 序号)
+        std::vector<std::pair<float, std::uint32_t>> best;
+        best.reserve(k + 1);
+        auto offer = [&](const Entry &entry)
+        {
+            const float d2 = squaredDistance(entry.center, center);
+            if (best.size() < k)
+            {
+                best.emplace_back(d2, entry.index);
+                std::push_heap(best.begin(), best.end());
+            }
+            else if (d2 < best.front().first)
+            {
+                std::pop_heap(best.begin(), best.end());
+                best.back() = {d2, entry.index};
+                std::push_heap(best.begin(), best.end());
+            }
+        };
+        auto worst = [&]()
+        {
+            return best.size() < k ? std::numeric_limits<float>::max() : best.front().first;
+        };
+
+        if (__backend == Backend::Grid)
+            knnGrid(center, offer, worst);
+        else
+            knnRTree(center, offer, worst);
+
+        std::sort_heap(best.begin(), best.end());
+        indices.reserve(best.size());
+        for (const auto &item : best)
+            indices.push_back(item.second);
+    }
+
+    /**
+     * @brief 邻近轮廓配对：质心距离不超过 max_distance 的所有轮廓对
+     *
+     * @param[in] max_distance 最大质心距离
+     * @param[out] pairs 轮廓序号对 (i, j)，满足 i < j (清空后写入)
+     */
+    void neighborPairs(float max_distance, std::vector<std::pair<size_t, size_t>> &pairs) const
+    {
+        pairs.clear();
+        std::vector<size_t> neighbors;
+        for (const auto &entry : __entries)
+        {
+            neighbors.clear();
+            radiusSearch(entry.center, max_distance, neighbors);
+            for (size_t j : neighbors)
+            {
+                if (j > entry.index)
+                    pairs.emplace_back(entry.index, j);
+            }
+        }
+    }
+
+    //----------------[轮廓查询接口]-------------------------
+
+    /**
+     * @brief 半径查询，返回轮廓指针
+     */
+    ContourGroup radiusSearch(const cv::Point2f &center, float radius) const
+    {
+        std::vector<size_t> indices;
+        radiusSearch(center, radius, indices);
+        return gather(indices);
+    }
+
+    /**
+     * @brief 包围盒重叠查询，返回轮廓指针
+     */
+    ContourGroup boxSearch(const cv::Rect2f &box) const
+    {
+        std::vector<size_t> indices;
+        boxSearch(box, indices);
+        return gather(indices);
+    }
+
+    /**
+     * @brief k 近邻查询，返回轮廓指针 (按距离由近到远排列)
+     */
+    ContourGroup knnSearch(const cv::Point2f &center, size_t k) const
+    {
+        std::vector<size_t> indices;
+        knnSearch(center, k, indices);
+        return gather(indices);
+    }
+
+private:
+    //----------------[几何辅助函数]-------------------------
+
+    static float squaredDistance(const cv::Point2f &a, const cv::Point2f &b)
+    {
+        const float dx = a.x - b.x, dy = a.y - b.y;
+        return dx * dx + dy * dy;
+    }
+
+    /**
+     * @brief 点到矩形的最小距离平方 (点在矩形内时为 0)
+     */
+    static float squaredDistance(const cv::Rect2f &box, const cv::Point2f &p)
+    {
+        const float dx = std::max({box.x - p.x, 0.f, p.x - (box.x + box.width)});
+        const float dy = std::max({box.y - p.y, 0.f, p.y - (box.y + box.height)});
+        return dx * dx + dy * dy;
+    }
+
+    static bool overlaps(const cv::Rect2f &a, const cv::Rect2f &b)
+    {
+        return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+               a.y <= b.y + b.height && b.y <= a.y + a.height;
+    }
+
+    static cv::Point2f boxCenter(const cv::Rect2f &box)
+    {
+        return cv::Point2f(box.x + 0.5f * box.width, box.y + 0.5f * box.height);
+    }
+
+    static cv::Rect2f unite(const cv::Rect2f &a, const cv::Rect2f &b)
+    {
+        const float x0 = std::min(a.x, b.x), y0 = std::min(a.y, b.y);
+        const float x1 = std::max(a.x + a.width, b.x + b.width), y1 = std::max(a.y + a.height, b.y + b.height);
+        return cv::Rect2f(x0, y0, x1 - x0, y1 - y0);
+    }
+
+    ContourGroup gather(const std::vector<size_t> &indices) const
+    {
+        ContourGroup result;
+        result.reserve(indices.size());
+        for (size_t i : indices)
+            result.push_back(__contours[i]);
+        return result;
+    }
+
+    //----------------[均匀网格实现]-------------------------
+
+    int cellX(float x) const { return std::clamp(static_cast<int>((x - __extent.x) / __cell_size), 0, __cols - 1); }
+    int cellY(float y) const { return std::clamp(static_cast<int>((y - __extent.y) / __cell_size), 0, __rows - 1); }
+
+    /**
+     * @brief 构建网格 (质心与包围盒中心各一份，CSR 存储)
+     */
+    void buildGrid()
+    {
+        __cols = std::max(1, static_cast<int>(std::ceil(__extent.width / __cell_size)));
+        __rows = std::max(1, static_cast<int>(std::ceil(__extent.height / __cell_size)));
+
+        bucketEntries([](const Entry &entry)
+                      { return entry.center; },
+                      __cell_start, __cell_items);
+        bucketEntries([](const Entry &entry)
+                      { return boxCenter(entry.box); },
+                      __box_cell_start, __box_cell_items);
+    }
+
+    /**
+     * @brief 按 point_of 给出的位置将条目计数排序到网格中
+     *
+     * @param[in] point_of 条目的分桶位置
+     * @param[out] cell_start 每个网格在 cell_items 中的起始位置
+     * @param[out] cell_items 按网格排列的条目序号
+     */
+    template <typename PointOf>
+    void bucketEntries(PointOf &&point_of, std::vector<std::uint32_t> &cell_start, std::vector<std::uint32_t> &cell_items) const
+    {
+        const size_t cell_count = static_cast<size_t>(__cols) * __rows;
+        cell_start.assign(cell_count + 1, 0);
+        for (const auto &entry : __entries)
+        {
+            const cv::Point2f p = point_of(entry);
+            ++cell_start[cellY(p.y) * __cols + cellX(p.x) + 1];
+        }
+        for (size_t i = 0; i < cell_count; ++i)
+            cell_start[i + 1] += cell_start[i];
+
+        cell_items.resize(__entries.size());
+        std::vector<std::uint32_t> cursor(cell_start.begin(), cell_start.end() - 1);
+        for (std::uint32_t i = 0; i < __entries.size(); ++i)
+        {
+            const cv::Point2f p = point_of(__entries[i]);
+            cell_items[cursor[cellY(p.y) * __cols + cellX(p.x)]++] = i;
+        }
+    }
+
+    /**
+     * @brief 遍历与区域相交的网格中的所有条目
+     *
+     * @param[in] region 查询区域
+     * @param[in] cell_start 每个网格的起始位置
+     * @param[in] cell_items 按网格排列的条目序号
+     * @param[in] visit 访问函数
+     */
+    template <typename Visitor>
+    void forEachCellEntry(const cv::Rect2f &region, const std::vector<std::uint32_t> &cell_start,
+                          const std::vector<std::uint32_t> &cell_items, Visitor &&visit) const
+    {
+        if (!overlaps(region, __extent))
+            return;
+        const int x0 = cellX(region.x), x1 = cellX(region.x + region.width);
+        const int y0 = cellY(region.y), y1 = cellY(region.y + region.height);
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                const size_t cell = static_cast<size_t>(y) * __cols + x;
+                for (std::uint32_t i = cell_start[cell]; i < cell_start[cell + 1]; ++i)
+                    visit(__entries[cell_items[i]]);
+            }
+        }
+    }
+
+    /**
+     * @brief 网格 k 近邻：由内向外逐环扩展，直到环的最近距离超过当前第 k 近距离
+     */
+    template <typename Offer, typename Worst>
+    void knnGrid(const cv::Point2f &center, Offer &&offer, Worst &&worst) const
+    {
+        const int cx = cellX(center.x), cy = cellY(center.y);
+        const int max_ring = std::max({cx, cy, __cols - 1 - cx, __rows - 1 - cy});
+        for (int ring = 0; ring <= max_ring; ++ring)
+        {
+            // 第 ring 环内任意点到查询点的距离下界
+            if (ring > 0)
+            {
+                const float bound = (ring - 1) * __cell_size;
+                if (bound * bound > worst())
+                    break;
+            }
+            for (int y = cy - ring; y <= cy + ring; ++y)
+            {
+                if (y < 0 || y >= __rows)
+                    continue;
+                const bool edge_row = (y == cy - ring || y == cy + ring);
+                for (int x = cx - ring; x <= cx + ring; x += (edge_row ? 1 : 2 * std::max(ring, 1)))
+                {
+                    if (x < 0 || x >= __cols)
+                        continue;
+                    const size_t cell = static_cast<size_t>(y) * __cols + x;
+                    for (std::uint32_t i = __cell_start[cell]; i < __cell_start[cell + 1]; ++i)
+                        offer(__entries[__cell_items[i]]);
+                }
+            }
+        }
+    }
+
+    //----------------[R 树实现]-------------------------
+
+    /**
+     * @brief 按 STR (Sort-Tile-Recursive) 方式自底向上打包 R 树
+     *
+     * @note 节点按层连续存放，根节点位于 __nodes 末尾
+     */
+    void buildRTree()
+    {
+        // 叶层：对条目做 STR 排序后按扇出分组
+        strSort(__entries.begin(), __entries.end(), [](const Entry &e)
+                { return e.center; });
+        size_t level_begin = 0;
+        for (std::uint32_t i = 0; i < __entries.size(); i += RTreeFanout)
+        {
+            const std::uint32_t count = std::min<std::uint32_t>(RTreeFanout, __entries.size() - i);
+            cv::Rect2f box = __entries[i].box;
+            for (std::uint32_t j = i + 1; j < i + count; ++j)
+                box = unite(box, __entries[j].box);
+            __nodes.push_back({box, i, count, true});
+        }
+
+        // 内部层：逐层打包，直到只剩根节点
+        while (__nodes.size() - level_begin > 1)
+        {
+            const size_t level_end = __nodes.size();
+            strSort(__nodes.begin() + level_begin, __nodes.begin() + level_end, [](const Node &n)
+                    { return boxCenter(n.box); });
+            for (size_t i = level_begin; i < level_end; i += RTreeFanout)
+            {
+                const std::uint32_t count = static_cast<std::uint32_t>(std::min<size_t>(RTreeFanout, level_end - i));
+                cv::Rect2f box = __nodes[i].box;
+                for (size_t j = i + 1; j < i + count; ++j)
+                    box = unite(box, __nodes[j].box);
+                __nodes.push_back({box, static_cast<std::uint32_t>(i), count, false});
+            }
+            level_begin = level_end;
+        }
+    }
+
+    /**
+     * @brief STR 排序：先按 x 分为若干竖条，条内再按 y 排序
+     */
+    template <typename Iter, typename CenterOf>
+    static void strSort(Iter first, Iter last, CenterOf center_of)
+    {
+        const size_t n = static_cast<size_t>(last - first);
+        const size_t leaf_count = (n + RTreeFanout - 1) / RTreeFanout;
+        const size_t slice_count = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leaf_count)))));
+        const size_t slice_size = slice_count * RTreeFanout;
+
+        std::sort(first, last, [&](const auto &a, const auto &b)
+                  { return center_of(a).x < center_of(b).x; });
+        for (size_t i = 0; i < n; i += slice_size)
+        {
+            auto slice_last = first + static_cast<std::ptrdiff_t>(std::min(n, i + slice_size));
+            std::sort(first + static_cast<std::ptrdiff_t>(i), slice_last, [&](const auto &a, const auto &b)
+                      { return center_of(a).y < center_of(b).y; });
+        }
+    }
+
+    /**
+     * @brief 深度优先遍历 R 树，仅进入满足 accept 的节点
+     */
+    template <typename Accept, typename Visitor>
+    void forEachRTreeEntry(Accept &&accept, Visitor &&visit) const
+    {
+        std::vector<std::uint32_t> stack{static_cast<std::uint32_t>(__nodes.size() - 1)};
+        while (!stack.empty())
+        {
+            const Node &node = __nodes[stack.back()];
+            stack.pop_back();
+            if (!accept(node.box))
+                continue;
+            if (node.leaf)
+            {
+                for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+                    visit(__entries[i]);
+            }
+            else
+            {
+                for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+                    stack.push_back(i);
+            }
+        }
+    }
+
+    /**
+     * @brief R 树 k 近邻：按节点最小距离的最佳优先搜索
+     */
+    template <typename Offer, typename Worst>
+    void knnRTree(const cv::Point2f &center, Offer &&offer, Worst &&worst) const
+    {
+        using Item = std::pair<float, std::uint32_t>;
+        std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+        const auto root = static_cast<std::uint32_t>(__nodes.size() - 1);
+        queue.emplace(squaredDistance(__nodes[root].box, center), root);
+        while (!queue.empty())
+        {
+            const auto [dist, node_index] = queue.top();
+            queue.pop();
+            if (dist > worst())
+                break;
+            const Node &node = __nodes[node_index];
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                if (node.leaf)
+                    offer(__entries[i]);
+                else
+                    queue.emplace(squaredDistance(__nodes[i].box, center), i);
+            }
+        }
+    }
+
+private:
+    ContourGroup __contours;                  //!< 输入轮廓组的副本
+    Backend __backend = Backend::Grid;        //!< 当前索引后端
+    std::vector<Entry> __entries;             //!< 索引条目
+    cv::Rect2f __extent;                      //!< 所有包围盒的全局范围
+    cv::Size2f __max_half_size;               //!< 包围盒半宽、半高的最大值
+
+    // 均匀网格
+    float __cell_size = 1.f;                  //!< 网格边长
+    int __cols = 0;                           //!< 网格列数
+    int __rows = 0;                           //!< 网格行数
+    std::vector<std::uint32_t> __cell_start;  //!< 每个网格在 __cell_items 中的起始位置 (按质心分桶)
+    std::vector<std::uint32_t> __cell_items;  //!< 按网格排列的条目序号 (按质心分桶)
+    std::vector<std::uint32_t> __box_cell_start; //!< 每个网格在 __box_cell_items 中的起始位置 (按包围盒中心分桶)
+    std::vector<std::uint32_t> __box_cell_items; //!< 按网格排列的条目序号 (按包围盒中心分桶)
+
+    // R 树
+    std::vector<Node> __nodes;                //!< 按层存放的节点，根节点位于末尾
+};
@@ -1,4 +1,6 @@
 #pragma once
 
 #include"contour_wrapper.hpp"
-#include"extensions.hpp"
\ No newline at end of file
+#include"contour_hierarchy.hpp"
+#include"extensions.hpp"
+#include"contour_index.hpp"
\ No newline at end of file
@@ -2,10 +2,16 @@
 
 #include <opencv2/opencv.hpp>
 #include <memory>
-#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <array>
 #include <math.h>
 
 #include "vis_core/core/logging/logging.h"
+#include "vis_core/core/logging/expected.hpp"
 /**
  * @brief 可以用于ContourWrapper的基本算术类型 int 、float 和 double
  */
@@ -41,30 +47,68 @@ public:
 
     friend class std::allocator<ContourWrapper<ValueType>>;
 
-private:
+public:
     /**
-     * @brief 缓存块基类
+     * @brief 缓存块
+     *
+     * @note - 非虚结构体，直接内嵌于 ContourWrapper 中，不产生额外的堆分配
+     *
+     *       - 首个 64 字节缓存行存放标志位与高频访问的标量(面积、包围盒、质心等)，
+     *         其后为低频访问的冷数据
      */
-    struct CacheBlockBase
+    struct alignas(64) CacheBlock
     {
-        virtual ~CacheBlockBase() = default; //!< 虚析构函数，确保派生类正确析构
+        enum CacheFlags : std::uint32_t
+        {
+            Area = 0,             //!< 面积
+            BoundingRect = 1,     //!< 包围盒
+            Center = 2,           //!< 质心
+            PerimeterClose = 3,   //!< 闭合轮廓周长
+            Circularity = 4,      //!< 圆度
+            PerimeterOpen = 5,    //!< 开放轮廓周长
+            ConvexArea = 6,       //!< 凸包面积
+            ConvexPerimeter = 7,  //!< 凸包周长
+            MinAreaRect = 8,      //!< 最小面积包围盒
+            FittedCircle = 9,     //!< 拟合圆
+            FittedEllipse = 10,   //!< 拟合椭圆
+            ConvexHull = 11,      //!< 凸包点集与凸包点索引
+            Moments = 12,         //!< 原始矩与中心矩
+            Orientation = 13,     //!< 主轴方向
+            Eccentricity = 14,    //!< 离心率
+            HuMoments = 15,       //!< Hu 不变矩
+        };
+
+        //-------- 热数据 (首个缓存行) --------
+        std::uint32_t flags = 0;                  //!< 标志位，每一位表示一项缓存状态
+        cv::Rect bounding_rect;                   //!< 包围盒
+        double area = 0.0;                        //!< 面积
+        KeyPointType center = KeyPointType(0, 0); //!< 质心
+        double perimeter_close = 0.0;             //!< 闭合轮廓周长
+        double circularity = 0.0;                 //!< 圆度
 
-        std::bitset<16> flags; //!< 标志位，使用16位表示不同的缓存状态
+        //-------- 冷数据 --------
+        double perimeter_open = 0.0;                     //!< 开放轮廓周长
+        double convex_area = 0.0;                        //!< 凸包面积
+        double convex_perimeter = 0.0;                   //!< 凸包周长
+        cv::RotatedRect min_area_rect;                   //!< 最小面积包围盒
+        cv::RotatedRect fitted_ellipse;                  //!< 拟合椭圆
+        KeyPointType circle_center = KeyPointType(0, 0); //!< 拟合圆圆心
+        KeyType circle_radius = 0;                       //!< 拟合圆半径
 
         /**
          * @brief 检验缓存状态
          */
-        bool isCached(size_t flag) const
+        bool isCached(CacheFlags flag) const
         {
-            return flags.test(flag);
+            return flags & (1u << flag);
         }
 
         /**
          * @brief 设置缓存状态
          */
-        void setCached(size_t flag)
+        void setCached(CacheFlags flag)
         {
-            flags.set(flag);
+            flags |= (1u << flag);
         }
 
         /**
@@ -72,9 +116,9 @@ private:
          *
          * @param flag 标志位
          */
-        void clearCached(size_t flag)
+        void clearCached(CacheFlags flag)
         {
-            flags.reset(flag);
+            flags &= ~(1u << flag);
         }
 
         /**
@@ -82,65 +126,49 @@ private:
          */
         void clearAllCached()
         {
-            flags.reset();
+            flags = 0;
         }
     };
 
-public:
     /**
-     * @brief 小型缓存块
+     * @brief 凸包缓存块
+     *
+     * @note 仅在首次查询凸包相关特征时单独分配
      */
-    struct SmallCacheBlock : public CacheBlockBase
+    struct HullCacheBlock
     {
-        enum CacheFlags : size_t
-        {
-            Area = 0,            //!< 面积
-            PerimeterClose = 1,  //!< 闭合轮廓周长
-            PerimeterOpen = 2,   //!< 开放轮廓周长
-            ConvexArea = 3,      //!< 凸包面积
-            ConvexPerimeter = 4, //!< 凸包周长
-            Circularity = 5,     //!< 圆度
-            Center = 6,          //!< 质心
-        };
-
-        double area = 0.0;                        //!< 面积
-        double perimeter_close = 0.0;             //!< 闭合轮廓周长
-        double perimeter_open = 0.0;              //!< 开放轮廓周长
-        double convex_area = 0.0;                 //!< 凸包面积
-        double convex_perimeter = 0.0;            //!< 凸包周长
-        double circularity = 0.0;                 //!< 圆度
-        KeyPointType center = KeyPointType(0, 0); //!< 质心
+        std::vector<PointType> convex_hull;   //!< 凸包点集
+        std::vector<int> convex_hull_indices; //!< 凸包点索引
     };
 
     /**
-     * @brief 大型缓存块
+     * @brief 矩缓存块
+     *
+     * @note 仅在首次查询 moments / orientation / eccentricity / huMoments 时单独分配，原始矩与中心矩只计算一次，
+     *       主轴方向、离心率与 Hu 不变矩均由其导出；质心直接存放于 CacheBlock 热数据中，查询质心不分配该块
      */
-    struct LargeCacheBlock : public CacheBlockBase
+    struct MomentsCacheBlock
     {
-        enum CacheFlags : size_t
-        {
-            BoundingRect = 0,      //!< 包围盒
-            MinAreaRect = 1,       //!< 最小面积包围盒
-            FittedCircle = 2,      //!< 拟合圆
-            FittedEllipse = 3,     //!< 拟合椭圆
-            ConvexHull = 4,        //!< 凸包点集
-            ConvexHullIndices = 5, //!< 凸包点索引
-        };
-
-        cv::Rect bounding_rect;               //!< 包围盒
-        cv::RotatedRect min_area_rect;        //!< 最小面积包围盒
-        CircleType fitted_circle;             //!< 拟合圆
-        cv::RotatedRect fitted_ellipse;       //!< 拟合椭圆
-        std::vector<PointType> convex_hull;   //!< 凸包点集
-        std::vector<int> convex_hull_indices; //!< 凸包点索引
+        cv::Moments moments;                   //!< 原始矩、中心矩与归一化中心矩
+        double orientation = 0.0;              //!< 主轴方向 (弧度)
+        double eccentricity = 0.0;             //!< 离心率
+        std::array<double, 7> hu_moments = {}; //!< Hu 不变矩
     };
 
+    // 面积、包围盒、质心与标志位须位于同一缓存行 (查询这三项不分配任何额外缓存块)
+    static_assert(alignof(CacheBlock) == 64, "CacheBlock 须按缓存行对齐");
+    static_assert(offsetof(CacheBlock, bounding_rect) + sizeof(cv::Rect) <= 64, "包围盒超出首个缓存行");
+    static_assert(offsetof(CacheBlock, area) + sizeof(double) <= 64, "面积超出首个缓存行");
+    static_assert(offsetof(CacheBlock, center) + sizeof(KeyPointType) <= 64, "质心超出首个缓存行");
+    static_assert(offsetof(CacheBlock, circularity) + sizeof(double) <= 64, "CacheBlock 热数据超出首个缓存行");
+
 public:
     //---------------[数据存储区]----------------------
 private:
     std::shared_ptr<const std::vector<PointType>> __points; //!< 轮廓点集
-    mutable std::unique_ptr<SmallCacheBlock> __small_cache; //!< 小型缓存块
-    mutable std::unique_ptr<LargeCacheBlock> __large_cache; //!< 大型缓存块
+    mutable CacheBlock __cache;                                 //!< 缓存块
+    mutable std::unique_ptr<HullCacheBlock> __hull_cache;       //!< 凸包缓存块
+    mutable std::unique_ptr<MomentsCacheBlock> __moments_cache; //!< 矩缓存块
 
 public:
     /**
@@ -149,8 +177,9 @@ public:
      */
     explicit ContourWrapper(const std::vector<PointType> &points)
         : __points(std::make_shared<const std::vector<PointType>>(points)),
-          __small_cache(nullptr),
-          __large_cache(nullptr)
+          __cache(),
+          __hull_cache(nullptr),
+          __moments_cache(nullptr)
     {
         if (points.empty())
         {
@@ -164,8 +193,9 @@ public:
      */
     explicit ContourWrapper(std::vector<PointType> &&points)
         : __points(std::make_shared<const std::vector<PointType>>(std::move(points))),
-          __small_cache(nullptr),
-          __large_cache(nullptr)
+          __cache(),
+          __hull_cache(nullptr),
+          __moments_cache(nullptr)
     {
         if (__points->empty())
         {
@@ -173,6 +203,24 @@ public:
         }
     }
 
+    /**
+     * @brief 构造函数（共享点集）
+     * @param points 轮廓点集的共享指针
+     *
+     * @note 不拷贝点集，多个轮廓包装器可共享同一份点集存储
+     */
+    explicit ContourWrapper(std::shared_ptr<const std::vector<PointType>> points)
+        : __points(std::move(points)),
+          __cache(),
+          __hull_cache(nullptr),
+          __moments_cache(nullptr)
+    {
+        if (!__points || __points->empty())
+        {
+            VISCORE_THROW_ERROR("轮廓点集不能为空");
+        }
+    }
+
     /**
      * @brief 禁用默认构造函数
      */
@@ -184,8 +232,9 @@ public:
      */
     explicit ContourWrapper(const ContourWrapper &other)
         : __points(other.__points),
-          __small_cache(other.__small_cache ? std::make_unique<SmallCacheBlock>(*other.__small_cache) : nullptr),
-          __large_cache(other.__large_cache ? std::make_unique<LargeCacheBlock>(*other.__large_cache) : nullptr)
+          __cache(other.__cache),
+          __hull_cache(other.__hull_cache ? std::make_unique<HullCacheBlock>(*other.__hull_cache) : nullptr),
+          __moments_cache(other.__moments_cache ? std::make_unique<MomentsCacheBlock>(*other.__moments_cache) : nullptr)
     {
         if (!__points || __points->empty())
         {
@@ -202,8 +251,9 @@ public:
         if (this != &other)
         {
             __points = other.__points;
-            __small_cache = other.__small_cache ? std::make_unique<SmallCacheBlock>(*other.__small_cache) : nullptr;
-            __large_cache = other.__large_cache ? std::make_unique<LargeCacheBlock>(*other.__large_cache) : nullptr;
+            __cache = other.__cache;
+            __hull_cache = other.__hull_cache ? std::make_unique<HullCacheBlock>(*other.__hull_cache) : nullptr;
+            __moments_cache = other.__moments_cache ? std::make_unique<MomentsCacheBlock>(*other.__moments_cache) : nullptr;
 
             if (!__points || __points->empty())
             {
@@ -219,8 +269,9 @@ public:
      */
     explicit ContourWrapper(ContourWrapper &&other) noexcept
         : __points(std::move(other.__points)),
-          __small_cache(std::move(other.__small_cache)),
-          __large_cache(std::move(other.__large_cache))
+          __cache(other.__cache),
+          __hull_cache(std::move(other.__hull_cache)),
+          __moments_cache(std::move(other.__moments_cache))
     {
         // 确保移动后仍然有有效的轮廓点集
         if (!__points || __points->empty())
@@ -228,8 +279,9 @@ public:
             VISCORE_THROW_ERROR("轮廓点集不能为空");
         }
         // 清理其他对象的缓存
-        other.__small_cache = nullptr;
-        other.__large_cache = nullptr;
+        other.__cache.clearAllCached();
+        other.__hull_cache = nullptr;
+        other.__moments_cache = nullptr;
     }
 
 
@@ -251,6 +303,86 @@ public:
         return std::make_shared<ContourWrapper>(std::move(points));
     }
 
+    /**
+     * @brief 指针构造接口 (不抛出异常)
+     *
+     * @return 点集为空时返回 ErrorCode::Empty
+     */
+    static Expected<ContourWrapper_ptr> tryCreate(const std::vector<PointType> &points)
+    {
+        if (points.empty())
+            return ErrorInfo(ErrorCode::Empty, "轮廓点集不能为空");
+        return std::make_shared<ContourWrapper>(points);
+    }
+
+    /**
+     * @brief 指针构造接口（移动构造，不抛出异常）
+     *
+     * @return 点集为空时返回 ErrorCode::Empty
+     */
+    static Expected<ContourWrapper_ptr> tryCreate(std::vector<PointType> &&points)
+    {
+        if (points.empty())
+            return ErrorInfo(ErrorCode::Empty, "轮廓点集不能为空");
+        return std::make_shared<ContourWrapper>(std::move(points));
+    }
+
+    /**
+     * @brief 指针构造接口（共享点集，零拷贝）
+     *
+     * @param points 轮廓点集的共享指针，可来自其他轮廓包装器的 sharedPoints()
+     */
+    static ContourWrapper_ptr create(std::shared_ptr<const std::vector<PointType>> points)
+    {
+        return std::make_shared<ContourWrapper>(std::move(points));
+    }
+
+    /**
+     * @brief 指针构造接口（共享点集，不抛出异常）
+     *
+     * @return 点集为空指针或为空时返回 ErrorCode::Empty
+     */
+    static Expected<ContourWrapper_ptr> tryCreate(std::shared_ptr<const std::vector<PointType>> points)
+    {
+        if (!points || points->empty())
+            return ErrorInfo(ErrorCode::Empty, "轮廓点集不能为空");
+        return std::make_shared<ContourWrapper>(std::move(points));
+    }
+
+    /**
+     * @brief 指针构造接口（数值类型转换）
+     *
+     * @param points 其他数值类型的轮廓点集
+     *
+     * @note 仅执行一次逐点转换，转换为 int 时四舍五入
+     */
+    template <ContourWrapperBaseType U>
+        requires(!std::is_same_v<std::remove_cv_t<U>, std::remove_cv_t<ValueType>>)
+    static ContourWrapper_ptr create(const std::vector<cv::Point_<U>> &points)
+    {
+        std::vector<PointType> converted;
+        converted.reserve(points.size());
+        for (const auto &point : points)
+        {
+            converted.emplace_back(cv::saturate_cast<ValueType>(point.x), cv::saturate_cast<ValueType>(point.y));
+        }
+        return std::make_shared<ContourWrapper>(std::move(converted));
+    }
+
+    /**
+     * @brief 指针构造接口（数值类型转换，不抛出异常）
+     *
+     * @return 点集为空时返回 ErrorCode::Empty
+     */
+    template <ContourWrapperBaseType U>
+        requires(!std::is_same_v<std::remove_cv_t<U>, std::remove_cv_t<ValueType>>)
+    static Expected<ContourWrapper_ptr> tryCreate(const std::vector<cv::Point_<U>> &points)
+    {
+        if (points.empty())
+            return ErrorInfo(ErrorCode::Empty, "轮廓点集不能为空");
+        return create(points);
+    }
+
     /**
      * @brief 获取点集
      */
@@ -259,6 +391,16 @@ public:
         return getPoints();
     }
 
+    /**
+     * @brief 获取点集的共享指针
+     *
+     * @note 用于在多个轮廓包装器之间零拷贝地共享点集
+     */
+    const auto &sharedPoints() const
+    {
+        return __points;
+    }
+
     /**
      * @brief 获取面积
      */
@@ -315,6 +457,42 @@ public:
         return calculateCenterImpl();
     }
 
+    /**
+     * @brief 获取轮廓矩 (原始矩、中心矩与归一化中心矩)
+     */
+    const auto &moments() const
+    {
+        return calculateMomentsImpl();
+    }
+
+    /**
+     * @brief 获取主轴方向
+     *
+     * @return 主轴与 x 轴的夹角 (弧度)，范围 (-π/2, π/2]
+     */
+    auto orientation() const
+    {
+        return calculateOrientationImpl();
+    }
+
+    /**
+     * @brief 获取离心率
+     *
+     * @return 由二阶中心矩得到的等效椭圆离心率，范围 [0, 1] (线状轮廓的最小特征值为 0，离心率为 1)
+     */
+    auto eccentricity() const
+    {
+        return calculateEccentricityImpl();
+    }
+
+    /**
+     * @brief 获取 Hu 不变矩
+     */
+    const auto &huMoments() const
+    {
+        return calculateHuMomentsImpl();
+    }
+
     /**
      * @brief 获取包围盒
      */
@@ -363,28 +541,36 @@ public:
         return calculateConvexHullIndicesImpl();
     }
 
+    /**
+     * @brief 同时获取凸包点集与凸包点索引
+     *
+     * @return std::tuple<const std::vector<PointType> &, const std::vector<int> &> (凸包点集, 凸包点索引)
+     *
+     * @note 两者由同一次凸包计算得到，不会重复运行凸包算法
+     */
+    auto convexHullWithIndices() const
+    {
+        return calculateConvexHullWithIndicesImpl();
+    }
+
     //----------------[计算实现区]-------------------------
 private:
     /**
-     * @brief 生成小型缓存块
-     * @return std::unique_ptr<SmallCacheBlock> 返回生成的小型缓存块
+     * @brief 生成凸包缓存块
+     * @return std::unique_ptr<HullCacheBlock> 返回生成的凸包缓存块
      */
-    auto generateSmallCache() const
+    auto generateHullCache() const
     {
-        auto cache = std::make_unique<SmallCacheBlock>();
-        cache->clearAllCached(); // 清除所有缓存状态
-        return cache;
+        return std::make_unique<HullCacheBlock>();
     }
 
     /**
-     * @brief 生成大型缓存块
-     * @return std::unique_ptr<LargeCacheBlock> 返回生成的大型缓存块
+     * @brief 生成矩缓存块
+     * @return std::unique_ptr<MomentsCacheBlock> 返回生成的矩缓存块
      */
-    auto generateLargeCache() const
+    auto generateMomentsCache() const
     {
-        auto cache = std::make_unique<LargeCacheBlock>();
-        cache->clearAllCached(); // 清除所有缓存状态
-        return cache;
+        return std::make_unique<MomentsCacheBlock>();
     }
 
     /**
@@ -411,16 +597,13 @@ private:
      */
     auto calculateAreaImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
-
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::Area))
+        if (!__cache.isCached(CacheBlock::Area))
         {
             const auto &points = getPoints();
-            __small_cache->area = cv::contourArea(points);
-            __small_cache->setCached(ContourWrapper<>::SmallCacheBlock::Area);
+            __cache.area = cv::contourArea(points);
+            __cache.setCached(CacheBlock::Area);
         }
-        return __small_cache->area;
+        return __cache.area;
     }
 
     /**
@@ -428,16 +611,13 @@ private:
      */
     auto calculatePerimeterCloseImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
-
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::PerimeterClose))
+        if (!__cache.isCached(CacheBlock::PerimeterClose))
         {
             const auto &points = getPoints();
-            __small_cache->perimeter_close = cv::arcLength(points, true);
-            __small_cache->setCached(ContourWrapper<>::SmallCacheBlock::PerimeterClose);
+            __cache.perimeter_close = cv::arcLength(points, true);
+            __cache.setCached(CacheBlock::PerimeterClose);
         }
-        return __small_cache->perimeter_close;
+        return __cache.perimeter_close;
     }
 
     /**
@@ -445,16 +625,13 @@ private:
      */
     auto calculatePerimeterOpenImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
-
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::PerimeterOpen))
+        if (!__cache.isCached(CacheBlock::PerimeterOpen))
         {
             const auto &points = getPoints();
-            __small_cache->perimeter_open = cv::arcLength(points, false);
-            __small_cache->setCached(ContourWrapper<>::SmallCacheBlock::PerimeterOpen);
+            __cache.perimeter_open = cv::arcLength(points, false);
+            __cache.setCached(CacheBlock::PerimeterOpen);
         }
-        return __small_cache->perimeter_open;
+        return __cache.perimeter_open;
     }
 
     /**
@@ -462,16 +639,14 @@ private:
      */
     auto calculateConvexAreaImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
-
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::ConvexArea))
+        if (!__cache.isCached(CacheBlock::ConvexArea))
         {
             const auto &convex_hull = calculateConvexHullImpl();
-            __small_cache->convex_area = cv::contourArea(convex_hull);
+            __cache.convex_area = cv::contourArea(convex_hull);
+            __cache.setCached(CacheBlock::ConvexArea);
         }
 
-        return __small_cache->convex_area;
+        return __cache.convex_area;
     }
 
     /**
@@ -479,16 +654,13 @@ private:
      */
     auto calculateConvexPerimeterImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
-
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::ConvexPerimeter))
+        if (!__cache.isCached(CacheBlock::ConvexPerimeter))
         {
             const auto &convex_hull = calculateConvexHullImpl();
-            __small_cache->convex_perimeter = cv::arcLength(convex_hull, true);
-            __small_cache->setCached(ContourWrapper<>::SmallCacheBlock::ConvexPerimeter);
+            __cache.convex_perimeter = cv::arcLength(convex_hull, true);
+            __cache.setCached(CacheBlock::ConvexPerimeter);
         }
-        return __small_cache->convex_perimeter;
+        return __cache.convex_perimeter;
     }
 
     /**
@@ -496,52 +668,123 @@ private:
      */
     auto calculateCircularityImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
-
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::Circularity))
+        if (!__cache.isCached(CacheBlock::Circularity))
         {
             auto area = calculateAreaImpl();
             auto perimeter = calculatePerimeterCloseImpl();
 
             if (perimeter > 0 && area > 0)
             {
-                __small_cache->circularity = 4 * CV_PI * (area / (perimeter * perimeter));
+                __cache.circularity = 4 * CV_PI * (area / (perimeter * perimeter));
             }
             else
             {
-                __small_cache->circularity = 0.0; // 避免除以零
+                __cache.circularity = 0.0; // 避免除以零
             }
-            __small_cache->setCached(ContourWrapper<>::SmallCacheBlock::Circularity);
+            __cache.setCached(CacheBlock::Circularity);
         }
-        return __small_cache->circularity;
+        return __cache.circularity;
     }
 
     /**
      * @brief 计算质心
+     *
+     * @note 质心只需原始矩 m00、m10、m01，矩缓存块尚未分配时在栈上计算，不为此分配矩缓存块
      */
     auto calculateCenterImpl() const
     {
-        if (__small_cache == nullptr)
-            __small_cache = generateSmallCache();
+        if (!__cache.isCached(CacheBlock::Center))
+        {
+            const cv::Moments m = __cache.isCached(CacheBlock::Moments) ? __moments_cache->moments
+                                                                         : cv::moments(getPoints(), true);
+            if (m.m00 != 0)
+            {
+                __cache.center.x = static_cast<KeyType>(m.m10 / m.m00);
+                __cache.center.y = static_cast<KeyType>(m.m01 / m.m00);
+            }
+            else
+            {
+                __cache.center.x = 0;
+                __cache.center.y = 0;
+            }
+            __cache.setCached(CacheBlock::Center);
+        }
+        return __cache.center;
+    }
+
+    /**
+     * @brief 计算轮廓矩
+     */
+    const cv::Moments &calculateMomentsImpl() const
+    {
+        if (__moments_cache == nullptr)
+            __moments_cache = generateMomentsCache();
 
-        if (!__small_cache->isCached(ContourWrapper<>::SmallCacheBlock::Center))
+        if (!__cache.isCached(CacheBlock::Moments))
         {
             const auto &points = getPoints();
-            cv::Moments m = cv::moments(points, true);
-            if (m.m00 != 0)
+            __moments_cache->moments = cv::moments(points, true);
+            __cache.setCached(CacheBlock::Moments);
+        }
+        return __moments_cache->moments;
+    }
+
+    /**
+     * @brief 计算主轴方向
+     */
+    auto calculateOrientationImpl() const
+    {
+        const auto &m = calculateMomentsImpl();
+
+        if (!__cache.isCached(CacheBlock::Orientation))
+        {
+            __moments_cache->orientation = 0.5 * std::atan2(2.0 * m.mu11, m.mu20 - m.mu02);
+            __cache.setCached(CacheBlock::Orientation);
+        }
+        return __moments_cache->orientation;
+    }
+
+    /**
+     * @brief 计算离心率
+     */
+    auto calculateEccentricityImpl() const
+    {
+        const auto &m = calculateMomentsImpl();
+
+        if (!__cache.isCached(CacheBlock::Eccentricity))
+        {
+            // 二阶中心矩协方差矩阵的两个特征值
+            const double half_sum = 0.5 * (m.mu20 + m.mu02);
+            const double half_diff = 0.5 * std::sqrt(4.0 * m.mu11 * m.mu11 + (m.mu20 - m.mu02) * (m.mu20 - m.mu02));
+            const double lambda_max = half_sum + half_diff;
+            const double lambda_min = half_sum - half_diff;
+
+            if (lambda_max > 0)
             {
-                __small_cache->center.x = static_cast<KeyType>(m.m10 / m.m00);
-                __small_cache->center.y = static_cast<KeyType>(m.m01 / m.m00);
+                __moments_cache->eccentricity = std::sqrt(std::max(0.0, 1.0 - lambda_min / lambda_max));
             }
             else
             {
-                __small_cache->center.x = 0;
-                __small_cache->center.y = 0;
+                __moments_cache->eccentricity = 0.0; // 退化轮廓
             }
-            __small_cache->setCached(ContourWrapper<>::SmallCacheBlock::Center);
+            __cache.setCached(CacheBlock::Eccentricity);
+        }
+        return __moments_cache->eccentricity;
+    }
+
+    /**
+     * @brief 计算 Hu 不变矩
+     */
+    const auto &calculateHuMomentsImpl() const
+    {
+        const auto &m = calculateMomentsImpl();
+
+        if (!__cache.isCached(CacheBlock::HuMoments))
+        {
+            cv::HuMoments(m, __moments_cache->hu_moments.data());
+            __cache.setCached(CacheBlock::HuMoments);
         }
-        return __small_cache->center;
+        return __moments_cache->hu_moments;
     }
 
     /**
@@ -549,16 +792,13 @@ private:
      */
     auto calculateBoundingRectImpl() const
     {
-        if (__large_cache == nullptr)
-            __large_cache = generateLargeCache();
-
-        if (!__large_cache->isCached(ContourWrapper<>::LargeCacheBlock::BoundingRect))
+        if (!__cache.isCached(CacheBlock::BoundingRect))
         {
             const auto &points = getPoints();
-            __large_cache->bounding_rect = cv::boundingRect(points);
-            __large_cache->setCached(ContourWrapper<>::LargeCacheBlock::BoundingRect);
+            __cache.bounding_rect = cv::boundingRect(points);
+            __cache.setCached(CacheBlock::BoundingRect);
         }
-        return __large_cache->bounding_rect;
+        return __cache.bounding_rect;
     }
 
     /**
@@ -566,16 +806,13 @@ private:
      */
     auto calculateMinAreaRectImpl() const
     {
-        if (__large_cache == nullptr)
-            __large_cache = generateLargeCache();
-
-        if (!__large_cache->isCached(ContourWrapper<>::LargeCacheBlock::MinAreaRect))
+        if (!__cache.isCached(CacheBlock::MinAreaRect))
         {
             const auto &points = getPoints();
-            __large_cache->min_area_rect = cv::minAreaRect(points);
-            __large_cache->setCached(ContourWrapper<>::LargeCacheBlock::MinAreaRect);
+            __cache.min_area_rect = cv::minAreaRect(points);
+            __cache.setCached(CacheBlock::MinAreaRect);
         }
-        return __large_cache->min_area_rect;
+        return __cache.min_area_rect;
     }
 
     /**
@@ -583,19 +820,17 @@ private:
      */
     auto calculateFittedCircleImpl() const
     {
-        if (__large_cache == nullptr)
-            __large_cache = generateLargeCache();
-
-        if (!__large_cache->isCached(ContourWrapper<>::LargeCacheBlock::FittedCircle))
+        if (!__cache.isCached(CacheBlock::FittedCircle))
         {
             const auto &points = getPoints();
             cv::Point2f center;
             float radius;
             cv::minEnclosingCircle(points, center, radius);
-            __large_cache->fitted_circle = std::make_tuple(KeyPointType(center.x, center.y), radius);
-            __large_cache->setCached(ContourWrapper<>::LargeCacheBlock::FittedCircle);
+            __cache.circle_center = KeyPointType(center.x, center.y);
+            __cache.circle_radius = static_cast<KeyType>(radius);
+            __cache.setCached(CacheBlock::FittedCircle);
         }
-        return __large_cache->fitted_circle;
+        return CircleType(__cache.circle_center, __cache.circle_radius);
     }
 
     /**
@@ -603,10 +838,7 @@ private:
      */
     auto calculateFittedEllipseImpl() const
     {
-        if (__large_cache == nullptr)
-            __large_cache = generateLargeCache();
-
-        if (!__large_cache->isCached(ContourWrapper<>::LargeCacheBlock::FittedEllipse))
+        if (!__cache.isCached(CacheBlock::FittedEllipse))
         {
             const auto &points = getPoints();
 
@@ -676,10 +908,10 @@ private:
             {
                 VISCORE_THROW_ERROR("轮廓点数不足，无法拟合椭圆");
             }
-            __large_cache->fitted_ellipse = std::move(fit_ellipse);
-            __large_cache->setCached(ContourWrapper<>::LargeCacheBlock::FittedEllipse);
+            __cache.fitted_ellipse = std::move(fit_ellipse);
+            __cache.setCached(CacheBlock::FittedEllipse);
         }
-        return __large_cache->fitted_ellipse;
+        return __cache.fitted_ellipse;
     }
 
     /**
@@ -687,24 +919,7 @@ private:
      */
     const auto &calculateConvexHullImpl() const
     {
-        if (__large_cache == nullptr)
-            __large_cache = generateLargeCache();
-
-        if (!__large_cache->isCached(ContourWrapper<>::LargeCacheBlock::ConvexHull))
-        {
-            const auto &points = getPoints();
-            if (points.size() < 3)
-            {
-                // 如果点数少于3，直接返回原始点集
-                __large_cache->convex_hull = points;
-            }
-            else
-            {
-                cv::convexHull(points, __large_cache->convex_hull);
-            }
-            __large_cache->setCached(ContourWrapper<>::LargeCacheBlock::ConvexHull);
-        }
-        return __large_cache->convex_hull;
+        return std::get<0>(calculateConvexHullWithIndicesImpl());
     }
 
     /**
@@ -712,34 +927,113 @@ private:
      */
     const auto &calculateConvexHullIndicesImpl() const
     {
-        if (__large_cache == nullptr)
-            __large_cache = generateLargeCache();
+        return std::get<1>(calculateConvexHullWithIndicesImpl());
+    }
+
+    /**
+     * @brief 计算凸包点集与凸包索引
+     *
+     * @note 一次单调链扫描同时填充凸包点集与凸包点索引
+     */
+    std::tuple<const std::vector<PointType> &, const std::vector<int> &> calculateConvexHullWithIndicesImpl() const
+    {
+        if (__hull_cache == nullptr)
+            __hull_cache = generateHullCache();
 
-        if (!__large_cache->isCached(ContourWrapper<>::LargeCacheBlock::ConvexHullIndices))
+        if (!__cache.isCached(CacheBlock::ConvexHull))
         {
             const auto &points = getPoints();
+            auto &hull = __hull_cache->convex_hull;
+            auto &indices = __hull_cache->convex_hull_indices;
             if (points.size() < 3)
             {
-                // 如果点数少于3，返回两个点的索引
-                __large_cache->convex_hull_indices.clear();
+                // 如果点数少于3，直接返回原始点集及其索引
+                hull = points;
+                indices.resize(points.size());
                 for (size_t i = 0; i < points.size(); ++i)
                 {
-                    __large_cache->convex_hull_indices.push_back(static_cast<int>(i));
+                    indices[i] = static_cast<int>(i);
                 }
             }
             else
             {
-                cv::convexHull(points, __large_cache->convex_hull_indices);
+                computeConvexHull(points, indices);
+                hull.resize(indices.size());
+                for (size_t i = 0; i < indices.size(); ++i)
+                {
+                    hull[i] = points[indices[i]];
+                }
             }
-            __large_cache->setCached(ContourWrapper<>::LargeCacheBlock::ConvexHullIndices);
+            __cache.setCached(CacheBlock::ConvexHull);
         }
-        return __large_cache->convex_hull_indices;
+        return {__hull_cache->convex_hull, __hull_cache->convex_hull_indices};
+    }
+
+    /**
+     * @brief 单调链 (Andrew's monotone chain) 凸包算法
+     *
+     * @param[in] points 轮廓点集 (点数不少于3)
+     * @param[out] indices 凸包点在 points 中的索引
+     *
+     * @note - 输出方向与 cv::convexHull 默认方向一致 (clockwise = false)，共线点不计入凸包
+     *
+     *       - 未采用 Melkman 算法：cv::findContours 输出的单像素宽分支会沿原路折返，
+     *         轮廓并不保证为简单多边形，而 Melkman 仅对简单折线成立
+     */
+    static void computeConvexHull(const std::vector<PointType> &points, std::vector<int> &indices)
+    {
+        const int n = static_cast<int>(points.size());
+
+        // 按 (x, y) 字典序排序点索引，并剔除重复点
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&points](int a, int b)
+                  { return points[a].x < points[b].x || (points[a].x == points[b].x && points[a].y < points[b].y); });
+        order.erase(std::unique(order.begin(), order.end(), [&points](int a, int b)
+                                { return points[a] == points[b]; }),
+                    order.end());
+
+        const int m = static_cast<int>(order.size());
+        if (m < 3)
+        {
+            indices.assign(order.begin(), order.end());
+            return;
+        }
+
+        // 叉积使用 double 计算，避免 int 坐标溢出
+        auto cross = [&points](int o, int a, int b)
+        {
+            const double ox = points[o].x, oy = points[o].y;
+            return (points[a].x - ox) * (points[b].y - oy) - (points[a].y - oy) * (points[b].x - ox);
+        };
+
+        indices.resize(2 * m);
+        int k = 0;
+        // 下凸链
+        for (int i = 0; i < m; ++i)
+        {
+            while (k >= 2 && cross(indices[k - 2], indices[k - 1], order[i]) <= 0)
+                --k;
+            indices[k++] = order[i];
+        }
+        // 上凸链
+        for (int i = m - 2, lower_size = k + 1; i >= 0; --i)
+        {
+            while (k >= lower_size && cross(indices[k - 2], indices[k - 1], order[i]) <= 0)
+                --k;
+            indices[k++] = order[i];
+        }
+        // 末尾点与起点重复
+        indices.resize(k - 1);
     }
 };
 
-using ContourI_ptr = std::shared_ptr<const ContourWrapper<int>>;
-using ContourF_ptr = std::shared_ptr<const ContourWrapper<float>>;
-using ContourD_ptr = std::shared_ptr<const ContourWrapper<double>>;
+template <ContourWrapperBaseType _Tp>
+using ContourT_ptr = std::shared_ptr<const ContourWrapper<_Tp>>; //!< 指定数值类型的轮廓类型
+
+using ContourI_ptr = ContourT_ptr<int>;
+using ContourF_ptr = ContourT_ptr<float>;
+using ContourD_ptr = ContourT_ptr<double>;
 
 using Contour_ptr = ContourI_ptr; //!< 默认轮廓类型为int
 
@@ -2,22 +2,49 @@
 
 
 #include "contour_wrapper.hpp"
+#include "contour_hierarchy.hpp"
 #include <array>
+#include <unordered_map>
+
+namespace contour_proc_details
+{
+    /**
+     * @brief 由 cv::findContours 输出的整数轮廓构造指定数值类型的轮廓
+     *
+     * @note int 类型直接移动点集，float/double 类型仅执行一次逐点转换
+     */
+    template <ContourWrapperBaseType _Tp>
+    inline ContourT_ptr<_Tp> makeContour(std::vector<cv::Point> &&raw_contour)
+    {
+        if constexpr (std::is_same_v<std::remove_cv_t<_Tp>, int>)
+        {
+            return ContourWrapper<int>::create(std::move(raw_contour));
+        }
+        else
+        {
+            return ContourWrapper<_Tp>::create(raw_contour);
+        }
+    }
+}
+
 /**
  * @brief 增强版轮廓检测函数，返回智能轮廓对象集合
  *
  * @param[in] image 输入图像(二值图，建议使用clone保留原始数据)
- * @param[out] contours 输出轮廓集合(Contour_ptr对象)
+ * @param[out] contours 输出轮廓集合(ContourT_ptr对象，数值类型可为 int 、float 或 double)
  * @param[out] hierarchy 输出轮廓层级信息
  * @param[in] mode 轮廓检索模式
  * @param[in] method 轮廓近似方法
  * @param[in] offset 轮廓点坐标偏移量
  *
- * @note 自动执行抗锯齿处理(根据ENABLE_SMOOTH_CONTOUR_CALC配置)
+ * @note - 自动执行抗锯齿处理(根据ENABLE_SMOOTH_CONTOUR_CALC配置)
+ *
+ *       - float/double 轮廓直接由整数轮廓一次转换得到，后续的亚像素细化无需再回转为 int
  */
 
+template <ContourWrapperBaseType _Tp>
 inline void findContours(cv::InputArray image,
-                         std::vector<Contour_ptr> &contours,
+                         std::vector<ContourT_ptr<_Tp>> &contours,
                          cv::OutputArray hierarchy,
                          int mode = cv::RETR_TREE,
                          int method = cv::CHAIN_APPROX_NONE,
@@ -33,10 +60,42 @@ inline void findContours(cv::InputArray image,
     // 将OpenCV的轮廓转换为智能指针类型
     for (auto &&cv_contour : cv_contours)
     {
-        contours.emplace_back(ContourWrapper<int>::create(std::move(cv_contour)));
+        contours.emplace_back(contour_proc_details::makeContour<_Tp>(std::move(cv_contour)));
     }
 }
 
+/**
+ * @brief 增强版轮廓检测函数，返回智能轮廓对象集合
+ *
+ * @param[in] image 输入图像(二值图，建议使用clone保留原始数据)
+ * @param[out] contours 输出轮廓集合(ContourT_ptr对象)
+ * @param[out] hierarchy 输出轮廓层级信息 (扁平层级，节点序号与 contours 一致)
+ * @param[in] mode 轮廓检索模式
+ * @param[in] method 轮廓近似方法
+ * @param[in] offset 轮廓点坐标偏移量
+ *
+ * @note 相比 unordered_map 形式的层级，不产生逐轮廓的哈希节点与智能指针拷贝，推荐优先使用
+ */
+template <ContourWrapperBaseType _Tp>
+inline void findContours(cv::InputArray image,
+                         std::vector<ContourT_ptr<_Tp>> &contours,
+                         ContourHierarchy &hierarchy,
+                         int mode = cv::RETR_TREE,
+                         int method = cv::CHAIN_APPROX_NONE,
+                         const cv::Point &offset = cv::Point(0, 0))
+{
+    contours.clear();
+    std::vector<std::vector<cv::Point>> raw_contours;
+    std::vector<cv::Vec4i> hierarchy_vec;
+    cv::findContours(image, raw_contours, hierarchy_vec, mode, method, offset);
+    contours.reserve(raw_contours.size());
+    for (auto &&contour : raw_contours)
+    {
+        contours.emplace_back(contour_proc_details::makeContour<_Tp>(std::move(contour)));
+    }
+    hierarchy.assign(hierarchy_vec);
+}
+
 /**
  * @brief 增强版轮廓检测函数，返回智能轮廓对象集合
  *
@@ -51,9 +110,10 @@ inline void findContours(cv::InputArray image,
  * 
  *         - hierarchy : unordered_map < 当前轮廓, std::tuple<后一个轮廓,前一个轮廓,内嵌轮廓,父轮廓>
  */
+template <ContourWrapperBaseType _Tp>
 inline void findContours(cv::InputArray image,
-                         std::vector<Contour_ptr> &contours,
-                         std::unordered_map<Contour_ptr, std::tuple<Contour_ptr, Contour_ptr, Contour_ptr, Contour_ptr>> &hierarchy,
+                         std::vector<ContourT_ptr<_Tp>> &contours,
+                         std::unordered_map<ContourT_ptr<_Tp>, std::tuple<ContourT_ptr<_Tp>, ContourT_ptr<_Tp>, ContourT_ptr<_Tp>, ContourT_ptr<_Tp>>> &hierarchy,
                          int mode = cv::RETR_TREE,
                          int method = cv::CHAIN_APPROX_NONE,
                          const cv::Point &offset = cv::Point(0, 0))
@@ -64,7 +124,7 @@ inline void findContours(cv::InputArray image,
     contours.reserve(raw_contours.size());
     for (auto &&contour : raw_contours)
     {
-        contours.emplace_back(ContourWrapper<int>::create(std::move(contour)));
+        contours.emplace_back(contour_proc_details::makeContour<_Tp>(std::move(contour)));
     }
     hierarchy.reserve(raw_contours.size());
     for (size_t i = 0; i < raw_contours.size(); ++i)
@@ -93,9 +153,10 @@ inline void findContours(cv::InputArray image,
  *
  *         - hierarchy : unordered_map < 当前轮廓, std::array<后一个轮廓,前一个轮廓,内嵌轮廓,父轮廓>
  */
+template <ContourWrapperBaseType _Tp>
 inline void findContours(cv::InputArray image,
-                         std::vector<Contour_ptr> &contours,
-                         std::unordered_map<Contour_ptr, std::array<Contour_ptr, 4>> &hierarchy,
+                         std::vector<ContourT_ptr<_Tp>> &contours,
+                         std::unordered_map<ContourT_ptr<_Tp>, std::array<ContourT_ptr<_Tp>, 4>> &hierarchy,
                          int mode = cv::RETR_TREE,
                          int method = cv::CHAIN_APPROX_NONE,
                          const cv::Point &offset = cv::Point(0, 0))
@@ -106,7 +167,7 @@ inline void findContours(cv::InputArray image,
     contours.reserve(raw_contours.size());
     for (auto &&contour : raw_contours)
     {
-        contours.emplace_back(ContourWrapper<int>::create(std::move(contour)));
+        contours.emplace_back(contour_proc_details::makeContour<_Tp>(std::move(contour)));
     }
     hierarchy.reserve(raw_contours.size());
     for (size_t i = 0; i < raw_contours.size(); ++i)
@@ -133,8 +194,9 @@ inline void findContours(cv::InputArray image,
  *
  * @note 不输出层级信息
  */
+template <ContourWrapperBaseType _Tp>
 inline void findContours(cv::InputArray image,
-                         std::vector<Contour_ptr> &contours,
+                         std::vector<ContourT_ptr<_Tp>> &contours,
                          int mode = cv::RETR_TREE,
                          int method = cv::CHAIN_APPROX_NONE,
                          const cv::Point &offset = cv::Point(0, 0))
@@ -144,7 +206,7 @@ inline void findContours(cv::InputArray image,
     contours.reserve(raw_contours.size());
     for (auto &&contour : raw_contours)
     {
-        contours.emplace_back(ContourWrapper<int>::create(std::move(contour)));
+        contours.emplace_back(contour_proc_details::makeContour<_Tp>(std::move(contour)));
     }
 }
 // drawContours(image, contours, -1, color, thickness, LINE_8, noArray(), 0, Point(0, 0));
@@ -158,9 +220,14 @@ inline void findContours(cv::InputArray image,
  * @param[in] color 绘制颜色
  * @param[in] thickness 绘制线条的粗细
  * @param[in] lineType 绘制线条的类型
+ *
+ * @note - 所有轮廓通过一次 cv::polylines 调用批量绘制
+ *
+ *       - float/double 轮廓以 4 位小数的定点坐标绘制，保留亚像素位置
  */
+template <ContourWrapperBaseType _Tp>
 inline void drawContours(cv::InputOutputArray image,
-                  const std::vector<Contour_ptr> &contours,
+                  const std::vector<ContourT_ptr<_Tp>> &contours,
                   int contourIdx,
                   const cv::Scalar &color,
                   int thickness = 1,
@@ -171,13 +238,57 @@ inline void drawContours(cv::InputOutputArray image,
         throw std::out_of_range("Invalid contour index");
     }
 
-    for (size_t i = 0; i < contours.size(); ++i)
+    const size_t first = (contourIdx == -1) ? 0 : static_cast<size_t>(contourIdx);
+    const size_t last = (contourIdx == -1) ? contours.size() : first + 1;
+    if (first == last)
     {
-        if (contourIdx == -1 || contourIdx == static_cast<int>(i))
+        return;
+    }
+
+    // 收集各轮廓的首顶点指针与顶点数量，通过一次 cv::polylines 批量绘制
+    std::vector<const cv::Point *> point_ptrs;
+    std::vector<int> point_counts;
+    point_ptrs.reserve(last - first);
+    point_counts.reserve(last - first);
+    if constexpr (std::is_same_v<std::remove_cv_t<_Tp>, int>)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            const auto &points = contours[i]->points();
+            point_ptrs.push_back(points.data());
+            point_counts.push_back(static_cast<int>(points.size()));
+        }
+        cv::polylines(image, point_ptrs.data(), point_counts.data(), static_cast<int>(point_ptrs.size()),
+                      true, color, thickness, lineType);
+    }
+    else
+    {
+        constexpr int shift = 4; // 定点小数位数
+        constexpr double scale = 1 << shift;
+        size_t total = 0;
+        for (size_t i = first; i < last; ++i)
+        {
+            total += contours[i]->points().size();
+        }
+        std::vector<cv::Point> fixed_points;
+        fixed_points.reserve(total);
+        for (size_t i = first; i < last; ++i)
         {
-            const auto &contour = contours[i];
-            cv::polylines(image, contour->points(), true, color, thickness, lineType);
+            const auto &points = contours[i]->points();
+            for (const auto &point : points)
+            {
+                fixed_points.emplace_back(cvRound(point.x * scale), cvRound(point.y * scale));
+            }
+            point_counts.push_back(static_cast<int>(points.size()));
         }
+        // 定点坐标全部写入后再计算指针，避免扩容导致指针失效
+        const cv::Point *cursor = fixed_points.data();
+        for (int count : point_counts)
+        {
+            point_ptrs.push_back(cursor);
+            cursor += count;
+        }
+        cv::polylines(image, point_ptrs.data(), point_counts.data(), static_cast<int>(point_ptrs.size()),
+                      true, color, thickness, lineType, shift);
     }
 }
-
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class DrawBuffer
+ * @brief 绘制命令缓冲区
+ *
+ * 1. 特征节点将线段、折线、圆与文字以命令的形式追加到缓冲区，不直接操作图像
+ * 2. 相邻且样式相同的折线、线段合并为一个批次，渲染时通过一次 cv::polylines 完成
+ * 3. clear() 保留已分配的容量，逐帧复用时不产生额外的内存分配
+ *
+ * @note - 坐标以原图像素为单位记录，render 时可指定缩放比例，便于在降采样的叠加层上绘制
+ *
+ *       - 缓冲区可在识别线程中填充后通过 swap 或移动交给其他线程渲染，识别线程无需等待绘制完成
+ *
+ *       - 同一缓冲区不可同时追加与渲染
+ */
+class DrawBuffer
+{
+public:
+    using Ptr = std::shared_ptr<DrawBuffer>; //!< 智能指针类型
+
+    /**
+     * @brief 绘制样式
+     */
+    struct Style
+    {
+        cv::Scalar color;         //!< 绘制颜色
+        int thickness = 1;        //!< 线条粗细
+        int line_type = cv::LINE_8; //!< 线条类型
+        bool closed = false;      //!< 折线是否闭合 (仅折线有效)
+
+        bool operator==(const Style &other) const
+        {
+            return color == other.color && thickness == other.thickness &&
+                   line_type == other.line_type && closed == other.closed;
+        }
+    };
+
+private:
+    /**
+     * @brief 命令批次类型
+     */
+    enum class BatchKind : std::uint8_t
+    {
+        Polyline, //!< 折线 (含线段)
+        Circle,   //!< 圆
+        Text,     //!< 文字
+    };
+
+    /**
+     * @brief 命令批次
+     *
+     * @note first/count 为对应命令数组中的区间
+     */
+    struct Batch
+    {
+        BatchKind kind;
+        std::uint32_t first;
+        std::uint32_t count;
+        Style style;
+    };
+
+    //! 折线命令
+    struct PolylineCmd
+    {
+        std::uint32_t first; //!< 首个顶点在 __points 中的序号
+        std::uint32_t count; //!< 顶点数量
+    };
+
+    //! 圆命令
+    struct CircleCmd
+    {
+        cv::Point2f center;
+        float radius;
+    };
+
+    //! 文字命令
+    struct TextCmd
+    {
+        cv::Point2f org;
+        double font_scale;
+        int font_face;
+        std::uint32_t first; //!< 首个字符在 __chars 中的序号
+        std::uint32_t length; //!< 字符数量
+    };
+
+public:
+    DrawBuffer() = default;
+    DrawBuffer(DrawBuffer &&) = default;
+    DrawBuffer &operator=(DrawBuffer &&) = default;
+    DrawBuffer(const DrawBuffer &) = default;
+    DrawBuffer &operator=(const DrawBuffer &) = default;
+
+    /**
+     * @brief 构造接口
+     */
+    static Ptr create() { return std::make_shared<DrawBuffer>(); }
+
+    /**
+     * @brief 清空所有命令，保留已分配的容量
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 交换两个缓冲区的内容
+     */
+    void swap(DrawBuffer &other) noexcept;
+
+    /**
+     * @brief 判断缓冲区是否为空
+     */
+    bool empty() const noexcept { return __batches.empty(); }
+
+    /**
+     * @brief 获取批次数量 (即渲染时的绘制调用次数上限)
+     */
+    size_t batchCount() const noexcept { return __batches.size(); }
+
+    //----------------[命令追加接口]-------------------------
+
+    /**
+     * @brief 追加折线
+     *
+     * @param[in] points 顶点数组
+     * @param[in] count 顶点数量
+     * @param[in] style 绘制样式
+     */
+    void addPolyline(const cv::Point2f *points, size_t count, const Style &style);
+
+    /**
+     * @brief 追加折线
+     *
+     * @param[in] points 顶点集合 (整数、单精度或双精度点)
+     * @param[in] style 绘制样式
+     */
+    template <typename _Tp>
+    void addPolyline(const std::vector<cv::Point_<_Tp>> &points, const Style &style)
+    {
+        const auto first = beginPolyline(points.size(), style);
+        for (size_t i = 0; i < points.size(); ++i)
+            __points[first + i] = cv::Point2f(static_cast<float>(points[i].x), static_cast<float>(points[i].y));
+    }
+
+    /**
+     * @brief 追加线段
+     */
+    void addLine(const cv::Point2f &p1, const cv::Point2f &p2, const cv::Scalar &color, int thickness = 1, int line_type = cv::LINE_8);
+
+    /**
+     * @brief 追加圆
+     */
+    void addCircle(const cv::Point2f &center, float radius, const cv::Scalar &color, int thickness = 1, int line_type = cv::LINE_8);
+
+    /**
+     * @brief 追加文字
+     *
+     * @param[in] text 文字内容 (拷贝进缓冲区)
+     * @param[in] org 文字左下角位置
+     * @param[in] font_scale 字体缩放
+     * @param[in] color 绘制颜色
+     * @param[in] thickness 线条粗细
+     * @param[in] font_face 字体
+     */
+    void addText(std::string_view text, const cv::Point2f &org, double font_scale, const cv::Scalar &color,
+                 int thickness = 1, int font_face = cv::FONT_HERSHEY_SIMPLEX);
+
+    //----------------[渲染接口]-------------------------
+
+    /**
+     * @brief 按追加顺序渲染所有命令
+     *
+     * @param[in,out] image 目标图像
+     * @param[in] scale 坐标缩放比例，在 1/scale 倍降采样的叠加层上绘制时传入对应比例
+     *
+     * @note 折线以 4 位小数的定点坐标绘制，保留亚像素位置
+     */
+    void render(cv::Mat &image, double scale = 1.0) const;
+
+private:
+    /**
+     * @brief 为一条折线预留顶点并登记到批次中
+     *
+     * @return 首个顶点在 __points 中的序号
+     */
+    size_t beginPolyline(size_t count, const Style &style);
+
+    /**
+     * @brief 将命令登记到批次中，与上一批次类型和样式相同时直接合并
+     */
+    void appendBatch(BatchKind kind, std::uint32_t index, const Style &style);
+
+private:
+    std::vector<Batch> __batches;           //!< 命令批次 (按追加顺序)
+    std::vector<PolylineCmd> __polylines;   //!< 折线命令
+    std::vector<cv::Point2f> __points;      //!< 折线顶点
+    std::vector<CircleCmd> __circles;       //!< 圆命令
+    std::vector<TextCmd> __texts;           //!< 文字命令
+    std::string __chars;                    //!< 文字字符
+
+    // 渲染用的临时缓冲区，跨帧复用
+    mutable std::vector<cv::Point> __fixed_points;       //!< 定点坐标顶点
+    mutable std::vector<const cv::Point *> __fixed_ptrs; //!< 各折线的首顶点指针
+    mutable std::vector<int> __fixed_counts;             //!< 各折线的顶点数量
+};
+
+using DrawBuffer_ptr = std::shared_ptr<DrawBuffer>; //!< 绘制命令缓冲区指针类型
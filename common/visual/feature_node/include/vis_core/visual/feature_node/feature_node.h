@@ -8,7 +8,8 @@
 #include "vis_core/core/property_wrapper/property_wrapper.hpp"
 #include "vis_core/visual/contour_proc/contour_wrapper.hpp"
 #include "vis_core/visual/img_proc/image_wrapper.hpp"
-#include "vis_core/math/pose_proc/transform6D.hpp"
+#include "vis_core/math/pose_proc/pose_node.h"
+#include "draw_buffer.h"
 
 /**
  * @brief 特征节点
@@ -32,19 +33,54 @@ public:
         DEFINE_PROPERTY(SourceImage, public, public, (Img_ptr));
         //! 轮廓组
         DEFINE_PROPERTY(Contours, public, public, (std::vector<Contour_ptr>));
+        //! 亚像素轮廓组 (float)
+        DEFINE_PROPERTY(ContoursF, public, public, (std::vector<ContourF_ptr>));
+        //! 亚像素轮廓组 (double)
+        DEFINE_PROPERTY(ContoursD, public, public, (std::vector<ContourD_ptr>));
         //! 角点集
         DEFINE_PROPERTY(Corners, public, public, (std::vector<cv::Point2f>));
     }; 
 
     /**
      * @brief 位姿信息缓存块
+     *
+     * @note 位姿节点以坐标系标识为键，值为特征在该坐标系下的位姿 (frame_to_feature)
      */
     struct PoseCache
     {
         //! 位姿节点映射表类型
-        using PoseNodeMap = std::unordered_map<std::string, PoseNode>;
+        using PoseNodeMap = std::unordered_map<FrameId, PoseNode>;
         //! 位姿节点映射
         DEFINE_PROPERTY(PoseNodes, public, public, (PoseNodeMap));
+
+        /**
+         * @brief 获取特征在指定坐标系下的位姿
+         *
+         * @param[in] target 目标坐标系
+         * @param[in] tree 坐标系树
+         *
+         * @return 目标坐标系下的位姿 target_to_feature，没有可换算的位姿节点时返回错误信息
+         *
+         * @note 优先直接返回目标坐标系下的位姿节点，否则选取一个位于同一棵坐标系树中的节点，经由 tree 换算
+         */
+        Expected<PoseNode> poseIn(FrameId target, const PoseTree &tree) const
+        {
+            auto nodes = tryGetPoseNodes();
+            if (!nodes)
+                return nodes.error();
+            auto direct = nodes->find(target);
+            if (direct != nodes->end())
+                return direct->second;
+            if (!tree.contains(target))
+                return ErrorInfo(ErrorCode::NotFound, "坐标系不存在", target.name());
+            const FrameId target_root = tree.root(target);
+            for (const auto &[frame, frame_to_feature] : *nodes)
+            {
+                if (tree.contains(frame) && tree.root(frame) == target_root)
+                    return Transform6D::compose(tree.transform(target, frame), frame_to_feature);
+            }
+            return ErrorInfo(ErrorCode::NotFound, "没有可换算到目标坐标系的位姿节点", target.name());
+        }
     };
 
 private:
@@ -106,6 +142,27 @@ public:
         VISCORE_WARNING_INFO("Feature Node 未实现绘制逻辑");
     }
 
+    /**
+     * @brief 绘制特征 (追加到绘制命令缓冲区)
+     *
+     * @param buffer 绘制命令缓冲区
+     * @param color 绘制颜色
+     * @param thickness 绘制线条的粗细
+     * @param type 绘制类型
+     *
+     * @note - 仅记录绘制命令，不操作图像，由调用方统一调用 `DrawBuffer::render` 批量渲染
+     *
+     *       - 默认实现为空，子类可以重载此方法以实现具体的绘制逻辑
+     */
+    virtual void drawFeature(DrawBuffer &buffer, const cv::Scalar &color = cv::Scalar(100, 255, 0), int thickness = 2, DrawMask type = 0) const
+    {
+        (void)buffer;
+        (void)color;
+        (void)thickness;
+        (void)type;
+        VISCORE_WARNING_INFO("Feature Node 未实现绘制逻辑");
+    }
+
 protected:
 
 
@@ -10,7 +10,7 @@
  *
  * @param 角点 存放在 `FeatureNode::ImageCache::Corners` 中
  *
- * @param 轮廓组 存放在 `FeatureNode::ImageCache::Contours` 中
+ * @param 轮廓组 存放在 `FeatureNode::ImageCache::Contours` 中 (亚像素轮廓存放在 `ContoursF` 或 `ContoursD` 中)
  *
  * @param 位姿节点 存放在 `FeatureNode::PoseCache::PoseNodes` 中
  */
@@ -53,21 +53,33 @@ public:
      */
     virtual void drawFeature(cv::Mat &image, const cv::Scalar &color = cv::Scalar(100, 255, 0), int thickness = 2, DrawMask type = 0) const override;
 
+    /**
+     * @brief 绘制四边形特征 (追加到绘制命令缓冲区)
+     *
+     * @param buffer 绘制命令缓冲区
+     * @param color 绘制颜色
+     * @param thickness 绘制线条的粗细
+     * @param type 绘制类型
+     *
+     * @note 多个特征可追加到同一缓冲区后统一渲染，边框与轮廓线合并为批量的 cv::polylines 调用
+     */
+    virtual void drawFeature(DrawBuffer &buffer, const cv::Scalar &color = cv::Scalar(100, 255, 0), int thickness = 2, DrawMask type = 0) const override;
+
 protected:
     /**
      * @brief 绘制四边形特征 (实现)
      *
-     * @param image 要绘制的图像
+     * @param buffer 绘制命令缓冲区
      * @param color 绘制颜色
      * @param thickness 绘制线条的粗细
      * @param type 绘制类型
      *
-     * @note - 该方法用于在图像上绘制四边形特征的可视化表示
+     * @note - 该方法将四边形特征的可视化表示追加到绘制命令缓冲区
      *
      *      - type 可以由 `DrawMask` 组合而成，表示是否绘制边框、角点、轮廓线等，
      *              例如 type = DrawBorder | DrawCorners ,表示绘制边框和角点。
      */
-    virtual void drawFeatureImpl(cv::Mat &image, const cv::Scalar &color, int thickness, DrawMask type) const;
+    virtual void drawFeatureImpl(DrawBuffer &buffer, const cv::Scalar &color, int thickness, DrawMask type) const;
 };
 using QuadrilateralBase_ptr = std::shared_ptr<QuadrilateralBase>;
 using Quadrilateral_ptr = QuadrilateralBase_ptr; //!< 四边形特征节点指针类型
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "vis_core/visual/feature_node/draw_buffer.h"
+
+using namespace std;
+using namespace cv;
+
+//! 定点坐标的小数位数
+static constexpr int fixed_shift = 4;
+
+void DrawBuffer::clear() noexcept
+{
+    __batches.clear();
+    __polylines.clear();
+    __points.clear();
+    __circles.clear();
+    __texts.clear();
+    __chars.clear();
+}
+
+void DrawBuffer::swap(DrawBuffer &other) noexcept
+{
+    __batches.swap(other.__batches);
+    __polylines.swap(other.__polylines);
+    __points.swap(other.__points);
+    __circles.swap(other.__circles);
+    __texts.swap(other.__texts);
+    __chars.swap(other.__chars);
+}
+
+void DrawBuffer::appendBatch(BatchKind kind, uint32_t index, const Style &style)
+{
+    if (!__batches.empty())
+    {
+        auto &last = __batches.back();
+        if (last.kind == kind && last.style == style && last.first + last.count == index)
+        {
+            ++last.count;
+            return;
+        }
+    }
+    __batches.push_back({kind, index, 1, style});
+}
+
+size_t DrawBuffer::beginPolyline(size_t count, const Style &style)
+{
+    const size_t first = __points.size();
+    if (count == 0)
+        return first;
+    __points.resize(first + count);
+    appendBatch(BatchKind::Polyline, static_cast<uint32_t>(__polylines.size()), style);
+    __polylines.push_back({static_cast<uint32_t>(first), static_cast<uint32_t>(count)});
+    return first;
+}
+
+void DrawBuffer::addPolyline(const Point2f *points, size_t count, const Style &style)
+{
+    const auto first = beginPolyline(count, style);
+    std::copy(points, points + count, __points.begin() + first);
+}
+
+void DrawBuffer::addLine(const Point2f &p1, const Point2f &p2, const Scalar &color, int thickness, int line_type)
+{
+    const auto first = beginPolyline(2, {color, thickness, line_type, false});
+    __points[first] = p1;
+    __points[first + 1] = p2;
+}
+
+void DrawBuffer::addCircle(const Point2f &center, float radius, const Scalar &color, int thickness, int line_type)
+{
+    appendBatch(BatchKind::Circle, static_cast<uint32_t>(__circles.size()), {color, thickness, line_type, false});
+    __circles.push_back({center, radius});
+}
+
+void DrawBuffer::addText(string_view text, const Point2f &org, double font_scale, const Scalar &color, int thickness, int font_face)
+{
+    appendBatch(BatchKind::Text, static_cast<uint32_t>(__texts.size()), {color, thickness, LINE_8, false});
+    __texts.push_back({org, font_scale, font_face, static_cast<uint32_t>(__chars.size()), static_cast<uint32_t>(text.size())});
+    __chars.append(text);
+}
+
+void DrawBuffer::render(Mat &image, double scale) const
+{
+    const double fixed_scale = scale * (1 << fixed_shift);
+    auto to_fixed = [fixed_scale](const Point2f &p)
+    {
+        return Point(cvRound(p.x * fixed_scale), cvRound(p.y * fixed_scale));
+    };
+
+    // 一次性转换全部顶点，保证各批次的顶点指针在渲染期间有效
+    __fixed_points.resize(__points.size());
+    for (size_t i = 0; i < __points.size(); ++i)
+        __fixed_points[i] = to_fixed(__points[i]);
+
+    for (const auto &batch : __batches)
+    {
+        switch (batch.kind)
+        {
+        case BatchKind::Polyline:
+        {
+            __fixed_ptrs.clear();
+            __fixed_counts.clear();
+            for (uint32_t i = batch.first; i < batch.first + batch.count; ++i)
+            {
+                const auto &cmd = __polylines[i];
+                __fixed_ptrs.push_back(__fixed_points.data() + cmd.first);
+                __fixed_counts.push_back(static_cast<int>(cmd.count));
+            }
+            polylines(image, __fixed_ptrs.data(), __fixed_counts.data(), static_cast<int>(batch.count),
+                      batch.style.closed, batch.style.color, batch.style.thickness, batch.style.line_type, fixed_shift);
+            break;
+        }
+        case BatchKind::Circle:
+        {
+            for (uint32_t i = batch.first; i < batch.first + batch.count; ++i)
+            {
+                const auto &cmd = __circles[i];
+                circle(image, to_fixed(cmd.center), cvRound(cmd.radius * fixed_scale),
+                       batch.style.color, batch.style.thickness, batch.style.line_type, fixed_shift);
+            }
+            break;
+        }
+        case BatchKind::Text:
+        {
+            for (uint32_t i = batch.first; i < batch.first + batch.count; ++i)
+            {
+                const auto &cmd = __texts[i];
+                const Point org(cvRound(cmd.org.x * scale), cvRound(cmd.org.y * scale));
+                putText(image, __chars.substr(cmd.first, cmd.length), org, cmd.font_face, cmd.font_scale * scale,
+                        batch.style.color, batch.style.thickness);
+            }
+            break;
+        }
+        }
+    }
+}
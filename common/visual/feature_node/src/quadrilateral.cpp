@@ -33,31 +33,31 @@ inline int limitThickness(int thickness)
 /**
  * @brief 绘制四边型的四个角点
  *
- * @param image 要绘制的图像
+ * @param buffer 绘制命令缓冲区
  * @param corners 四边型的角点
  * @param color 绘制颜色
  * @param thickness 绘制线条的粗细
  */
-inline void drawCorners(cv::Mat &image, const std::vector<cv::Point2f> &corners, const cv::Scalar &color, int thickness)
+inline void drawCorners(DrawBuffer &buffer, const std::vector<cv::Point2f> &corners, const cv::Scalar &color, int thickness)
 {
     thickness = limitThickness(thickness);
     int radius = 5 * thickness;
 
     for (const auto &corner : corners)
     {
-        circle(image, corner, radius, color, thickness);
+        buffer.addCircle(corner, static_cast<float>(radius), color, thickness);
     }
 }
 
 /**
  * @brief 绘制边框
  *
- * @param image 要绘制的图像
+ * @param buffer 绘制命令缓冲区
  * @param corners 四边型的角点
  * @param color 绘制颜色
  * @param thickness 绘制线条的粗细
  */
-inline void drawQuadrilateralSide(cv::Mat &image, const std::vector<cv::Point2f> &corners, const cv::Scalar &color, int thickness)
+inline void drawQuadrilateralSide(DrawBuffer &buffer, const std::vector<cv::Point2f> &corners, const cv::Scalar &color, int thickness)
 {
     thickness = limitThickness(thickness);
     size_t corner_count = corners.size();
@@ -67,38 +67,56 @@ inline void drawQuadrilateralSide(cv::Mat &image, const std::vector<cv::Point2f>
         VISCORE_WARNING_INFO("drawQuadrilateralSide , 角点数量不为 4 : %i", static_cast<int>(corner_count));
         return; // 如果角点数量不为4，直接返回
     }
-    // 绘制四边形的轮廓线
-    for (size_t i = 0; i < corner_count; ++i)
-    {
-        size_t nextIndex = (i + 1) % corner_count;
-        line(image, corners[i], corners[nextIndex], color, thickness);
-    }
+    // 绘制四边形的轮廓线 (闭合折线)
+    buffer.addPolyline(corners, {color, thickness, LINE_8, true});
 }
 
 
 /**
  * @brief 标注角点的顺序
  *
- * @param image 要绘制的图像
+ * @param buffer 绘制命令缓冲区
  * @param corners 四边型的角点
  * @param color 绘制颜色
  * @param thickness 绘制线条的粗细
  */
-inline void labelCorners(cv::Mat &image, const std::vector<cv::Point2f> &corners, const cv::Scalar &color, int thickness)
+inline void labelCorners(DrawBuffer &buffer, const std::vector<cv::Point2f> &corners, const cv::Scalar &color, int thickness)
 {
     // 选择合适的文字大小，使得文字的大小约为线条粗细的两倍
     double fontScale = 0.5 * thickness;
     thickness = limitThickness(thickness);
     // 绘制角点的索引
+    static constexpr std::string_view digits = "0123456789";
     for (size_t i = 0; i < corners.size(); ++i)
     {
         const auto &corner = corners[i];
         // 在角点位置绘制索引
-        putText(image, to_string(i), corner + Point2f(10, 10), FONT_HERSHEY_SIMPLEX, fontScale, color, thickness);
+        if (i < digits.size())
+            buffer.addText(digits.substr(i, 1), corner + Point2f(10, 10), fontScale, color, thickness);
+        else
+            buffer.addText(to_string(i), corner + Point2f(10, 10), fontScale, color, thickness);
     }
 }
 
-void QuadrilateralBase::drawFeatureImpl(cv::Mat &image, const cv::Scalar &color, int thickness, DrawMask type) const
+/**
+ * @brief 绘制轮廓组
+ *
+ * @param buffer 绘制命令缓冲区
+ * @param contours 轮廓组
+ * @param color 绘制颜色
+ * @param thickness 绘制线条的粗细
+ */
+template <typename ContourGroup>
+inline void drawContourGroup(DrawBuffer &buffer, const ContourGroup &contours, const cv::Scalar &color, int thickness)
+{
+    const DrawBuffer::Style style{color, thickness, LINE_8, true};
+    for (const auto &contour : contours)
+    {
+        buffer.addPolyline(contour->points(), style);
+    }
+}
+
+void QuadrilateralBase::drawFeatureImpl(DrawBuffer &buffer, const cv::Scalar &color, int thickness, DrawMask type) const
 {
     // 限制线条粗细
     thickness = limitThickness(thickness);
@@ -109,7 +127,7 @@ void QuadrilateralBase::drawFeatureImpl(cv::Mat &image, const cv::Scalar &color,
         if(this->getImageCache().isSetCorners())
         {
             const auto &corners = this->getImageCache().getCorners();
-            drawQuadrilateralSide(image, corners, color, thickness);
+            drawQuadrilateralSide(buffer, corners, color, thickness);
         }
     }
 
@@ -119,7 +137,7 @@ void QuadrilateralBase::drawFeatureImpl(cv::Mat &image, const cv::Scalar &color,
         if(this->getImageCache().isSetCorners())
         {
             const auto &corners = this->getImageCache().getCorners();
-            drawCorners(image, corners, color, thickness);
+            drawCorners(buffer, corners, color, thickness);
         }
     }
 
@@ -128,8 +146,15 @@ void QuadrilateralBase::drawFeatureImpl(cv::Mat &image, const cv::Scalar &color,
     {
         if(this->getImageCache().isSetContours())
         {
-            const auto &contours = this->getImageCache().getContours();
-            drawContours(image, contours,-1, color, thickness);
+            drawContourGroup(buffer, this->getImageCache().getContours(), color, thickness);
+        }
+        if(this->getImageCache().isSetContoursF())
+        {
+            drawContourGroup(buffer, this->getImageCache().getContoursF(), color, thickness);
+        }
+        if(this->getImageCache().isSetContoursD())
+        {
+            drawContourGroup(buffer, this->getImageCache().getContoursD(), color, thickness);
         }
     }
 
@@ -139,12 +164,21 @@ void QuadrilateralBase::drawFeatureImpl(cv::Mat &image, const cv::Scalar &color,
         if(this->getImageCache().isSetCorners())
         {
             const auto &corners = this->getImageCache().getCorners();
-            labelCorners(image, corners, color, thickness);
+            labelCorners(buffer, corners, color, thickness);
         }
     }
 }
 
+void QuadrilateralBase::drawFeature(DrawBuffer &buffer, const cv::Scalar &color, int thickness, DrawMask type) const
+{
+    drawFeatureImpl(buffer, color, thickness, type);
+}
+
 void QuadrilateralBase::drawFeature(cv::Mat &image, const cv::Scalar &color, int thickness, DrawMask type) const
 {
-    drawFeatureImpl(image, color, thickness, type);
+    // 每个线程复用一个缓冲区，直接绘制到图像时同样走批量渲染路径
+    thread_local DrawBuffer buffer;
+    buffer.clear();
+    drawFeatureImpl(buffer, color, thickness, type);
+    buffer.render(image);
 }
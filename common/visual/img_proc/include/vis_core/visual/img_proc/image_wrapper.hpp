@@ -4,8 +4,10 @@
 #include<vector>
 #include<unordered_map>
 #include<string>
+#include<variant>
 
 #include"vis_core/core/logging/logging.h"
+#include "vis_core/core/logging/expected.hpp"
 #include "vis_core/visual/contour_proc/contour_proc.h"
 
 /**
@@ -19,7 +21,11 @@ public:
     using Ptr = std::shared_ptr<ImageWrapper>; //!< 图像包装器智能指针类型
     using ProcImgKey = std::string; //!< 处理图像映射的键类型
     using ContourGroupKey = std::string; //!< 轮廓组映射的键类型
-    using ContourGroup = std::vector<Contour_ptr>; //!< 轮廓组类型，存储多个轮廓指针
+    template <ContourWrapperBaseType _Tp>
+    using ContourGroupT = std::vector<ContourT_ptr<_Tp>>; //!< 指定数值类型的轮廓组类型
+    using ContourGroup = ContourGroupT<int>; //!< 轮廓组类型，存储多个轮廓指针
+    //! 任意数值类型的轮廓组，int 、float 与 double 轮廓无需相互转换即可存储
+    using AnyContourGroup = std::variant<ContourGroupT<int>, ContourGroupT<float>, ContourGroupT<double>>;
 
 
 public:
@@ -122,6 +128,30 @@ public:
         return getProcessedImageImpl(key);
     }
 
+    /**
+     * @brief 根据键获取图像 (不抛出异常)
+     *
+     * @param[in] key 处理图像的键
+     *
+     * @return 图像不存在时返回 ErrorCode::NotFound
+     */
+    Expected<cv::Mat &> tryGetImg(const ProcImgKey &key)
+    {
+        return tryGetProcessedImageImpl(key);
+    }
+
+    /**
+     * @brief 根据键获取图像 (不抛出异常)
+     *
+     * @param[in] key 处理图像的键
+     *
+     * @return 图像不存在时返回 ErrorCode::NotFound
+     */
+    Expected<const cv::Mat &> tryGetImg(const ProcImgKey &key) const
+    {
+        return tryGetProcessedImageImpl(key);
+    }
+
     /**
      * @brief 设置处理图像
      * 
@@ -145,14 +175,42 @@ public:
         setProcessedImageImpl(key, std::move(image));
     }
 
+    /**
+     * @brief 判断轮廓组是否存在
+     * @param[in] key 轮廓组的键
+     * @return true 存在
+     */
+    bool hasContourGroup(const ContourGroupKey &key) const
+    {
+        return __contour_group_map.find(key) != __contour_group_map.end();
+    }
+
     /**
      * @brief 获取轮廓组
      * 
+     * @tparam _Tp 轮廓的数值类型，默认为 int
      * @param[in] key 轮廓组的键
+     *
+     * @note 若存储的轮廓组数值类型与 _Tp 不一致，则抛出异常
      */
-    const ContourGroup& contour_group(const ContourGroupKey &key) const
+    template <ContourWrapperBaseType _Tp = int>
+    const ContourGroupT<_Tp>& contour_group(const ContourGroupKey &key) const
     {
-        return getContourGroupImpl(key);
+        return getContourGroupImpl<_Tp>(key);
+    }
+
+    /**
+     * @brief 获取轮廓组 (不抛出异常)
+     *
+     * @tparam _Tp 轮廓的数值类型，默认为 int
+     * @param[in] key 轮廓组的键
+     *
+     * @return 轮廓组不存在时返回 ErrorCode::NotFound，数值类型不一致时返回 ErrorCode::TypeMismatch
+     */
+    template <ContourWrapperBaseType _Tp = int>
+    Expected<const ContourGroupT<_Tp> &> tryContourGroup(const ContourGroupKey &key) const
+    {
+        return tryGetContourGroupImpl<_Tp>(key);
     }
 
     /**
@@ -161,7 +219,8 @@ public:
      * @param[in] key 轮廓组的键
      * @param[in] contours 轮廓组
      */
-    void setContourGroup(const ContourGroupKey &key, const ContourGroup &contours)
+    template <ContourWrapperBaseType _Tp>
+    void setContourGroup(const ContourGroupKey &key, const ContourGroupT<_Tp> &contours)
     {
         setContourGroupImpl(key, contours);
     }
@@ -172,7 +231,8 @@ public:
      * @param[in] key 轮廓组的键
      * @param[in] contours 轮廓组
      */
-    void setContourGroup(const ContourGroupKey &key, ContourGroup &&contours)
+    template <ContourWrapperBaseType _Tp>
+    void setContourGroup(const ContourGroupKey &key, ContourGroupT<_Tp> &&contours)
     {
         setContourGroupImpl(key, std::move(contours));
     }
@@ -205,15 +265,7 @@ private:
      */
     cv::Mat& getProcessedImageImpl(const ProcImgKey &key)
     {
-        auto it = __processed_image_map.find(key);
-        if (it != __processed_image_map.end())
-        {
-            return it->second;
-        }
-        else
-        {
-            VISCORE_THROW_ERROR("处理图像不存在，键：%s", key.c_str());
-        }
+        return tryGetProcessedImageImpl(key).value();
     }
 
 
@@ -223,16 +275,34 @@ private:
      * @param[in] key 处理图像的键
      */
     const cv::Mat& getProcessedImageImpl(const ProcImgKey &key) const
+    {
+        return tryGetProcessedImageImpl(key).value();
+    }
+
+    /**
+     * @brief 获取处理过的图像 (不抛出异常)
+     *
+     * @param[in] key 处理图像的键
+     */
+    Expected<cv::Mat &> tryGetProcessedImageImpl(const ProcImgKey &key)
     {
         auto it = __processed_image_map.find(key);
-        if (it != __processed_image_map.end())
-        {
-            return it->second;
-        }
-        else
-        {
-            VISCORE_THROW_ERROR("处理图像不存在，键：%s", key.c_str());
-        }
+        if (it == __processed_image_map.end())
+            return ErrorInfo(ErrorCode::NotFound, "处理图像不存在", key);
+        return it->second;
+    }
+
+    /**
+     * @brief 获取处理过的图像 (不抛出异常)
+     *
+     * @param[in] key 处理图像的键
+     */
+    Expected<const cv::Mat &> tryGetProcessedImageImpl(const ProcImgKey &key) const
+    {
+        auto it = __processed_image_map.find(key);
+        if (it == __processed_image_map.end())
+            return ErrorInfo(ErrorCode::NotFound, "处理图像不存在", key);
+        return it->second;
     }
 
     /**
@@ -273,17 +343,27 @@ private:
      * 
      * @param[in] key 轮廓组的键
      */
-    const ContourGroup& getContourGroupImpl(const ContourGroupKey &key) const
+    template <ContourWrapperBaseType _Tp>
+    const ContourGroupT<_Tp>& getContourGroupImpl(const ContourGroupKey &key) const
+    {
+        return tryGetContourGroupImpl<_Tp>(key).value();
+    }
+
+    /**
+     * @brief 获取轮廓组 (不抛出异常)
+     * 
+     * @param[in] key 轮廓组的键
+     */
+    template <ContourWrapperBaseType _Tp>
+    Expected<const ContourGroupT<_Tp> &> tryGetContourGroupImpl(const ContourGroupKey &key) const
     {
         auto it = __contour_group_map.find(key);
-        if (it != __contour_group_map.end())
-        {
-            return it->second;
-        }
-        else
-        {
-            VISCORE_THROW_ERROR("轮廓组不存在，键：%s", key.c_str());
-        }
+        if (it == __contour_group_map.end())
+            return ErrorInfo(ErrorCode::NotFound, "轮廓组不存在", key);
+        const auto *group = std::get_if<ContourGroupT<_Tp>>(&it->second);
+        if (group == nullptr)
+            return ErrorInfo(ErrorCode::TypeMismatch, "轮廓组数值类型不匹配", key);
+        return *group;
     }
 
     /**
@@ -292,7 +372,8 @@ private:
      * @param[in] key 轮廓组的键
      * @param[in] contours 轮廓组
      */
-    void setContourGroupImpl(const ContourGroupKey &key, const ContourGroup &contours)
+    template <ContourWrapperBaseType _Tp>
+    void setContourGroupImpl(const ContourGroupKey &key, const ContourGroupT<_Tp> &contours)
     {
         if (contours.empty())
         {
@@ -307,7 +388,8 @@ private:
      * @param[in] key 轮廓组的键
      * @param[in] contours 轮廓组
      */
-    void setContourGroupImpl(const ContourGroupKey &key, ContourGroup &&contours)
+    template <ContourWrapperBaseType _Tp>
+    void setContourGroupImpl(const ContourGroupKey &key, ContourGroupT<_Tp> &&contours)
     {
         if (contours.empty())
         {
@@ -321,7 +403,7 @@ private:
 private:
     cv::Mat __source_image; //!< 源图像
     std::unordered_map<ProcImgKey, cv::Mat> __processed_image_map;                 //!< 处理过的图像
-    std::unordered_map<ContourGroupKey, ContourGroup> __contour_group_map;         //!< 轮廓组
+    std::unordered_map<ContourGroupKey, AnyContourGroup> __contour_group_map;      //!< 轮廓组
 };
 
 using ImageWrapper_ptr = std::shared_ptr<ImageWrapper>; //!< 图像包装器指针类型
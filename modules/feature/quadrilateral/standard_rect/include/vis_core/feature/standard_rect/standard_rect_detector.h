@@ -3,14 +3,23 @@
 #include "standard_rect.h"
 #include "vis_core/visual/img_proc/image_wrapper.hpp"
 #include "vis_core/utils/camera/camera_wrapper.h"
+#include "vis_core/utils/debug_view/debug_view.h"
+#include "standard_rect_params.h"
+
+#include <array>
 
 /**
  * @brief 标准矩形识别器
+ *
+ * @note 显式开启 DetectorParams::undistort_binary (默认关闭) 且相机存在畸变、图像尺寸与相机一致时，
+ *       二值化时融合去畸变：逐条带 remap + cvtColor + inRange，只读取一次原图，得到去畸变空间中的二值图
  */
 class StandardRectDetector 
 {
 public:
     using Ptr = std::shared_ptr<StandardRectDetector>; //!< 智能指针类型
+
+    static constexpr int FUSED_STRIP_ROWS = 16; //!< 融合去畸变时每个条带的行数
     StandardRectDetector() = default;
     virtual ~StandardRectDetector() = default;
 
@@ -22,12 +31,39 @@ protected:
     DEFINE_PROPERTY(BinaryImage, public, protected, (cv::Mat));
     //! 相机信息
     DEFINE_PROPERTY(Camera, public, protected, (Camera_ptr));
+    //! 二值化图像是否位于去畸变空间
+    DEFINE_PROPERTY_WITH_INIT(BinaryUndistorted, public, protected, (bool), false);
+    //! 调试可视化输出 (未设置时使用 DebugViewSink::instance())
+    DEFINE_PROPERTY(DebugSink, public, public, (DebugViewSink_ptr));
+    //! 跨进程共享参数块 (设置后每帧开始时将其中的参数同步到本识别器的参数快照)
+    DEFINE_PROPERTY(SharedParams, public, public, (ParamSharedBlock_ptr<DetectorParams>));
 public:
     /**
-     * @brief 构造接口
+     * @brief 构造接口 (使用默认配置 yml/DetectorParams.yml，并监视文件变化)
      */
     static Ptr create();
 
+    /**
+     * @brief 构造接口
+     *
+     * @param[in] params 识别参数 (不监视文件变化)
+     */
+    static Ptr create(const DetectorParams &params);
+
+    /**
+     * @brief 构造接口
+     *
+     * @param[in] profile 配置名，读取 yml/DetectorParams_<profile>.yml 并监视文件变化，为空时使用默认配置
+     */
+    static Ptr create(const std::string &profile);
+
+    /**
+     * @brief 获取参数快照
+     *
+     * @note 可通过 publish / update 在运行时修改本识别器的参数，不影响其他识别器
+     */
+    const ParamSnapshot_ptr<DetectorParams> &paramSnapshot() const noexcept { return __param_snapshot; }
+
     /**
      * @brief 识别标准矩形
      * @param[in] img_ptr 输入图像
@@ -54,6 +90,46 @@ protected:
      */
     void binarize(Img_ptr &img_ptr);
 
+    /**
+     * @brief 颜色空间转换并按 HSV 阈值二值化
+     *
+     * @param[in] src BGR 图像
+     * @param[out] hsv HSV 图像
+     * @param[out] binary 二值图像
+     */
+    void thresholdHSV(const cv::Mat &src, cv::Mat &hsv, cv::Mat &binary) const;
+
+    /**
+     * @brief 融合去畸变的二值化：逐条带 remap 后转换颜色空间并按阈值二值化
+     *
+     * @param[in] src BGR 图像 (含畸变)
+     * @param[in] camera 相机
+     * @param[out] hsv 去畸变后的 HSV 图像
+     * @param[out] binary 去畸变后的二值图像
+     *
+     * @note 去畸变后的 BGR 图像只存在于条带缓冲区中，不生成整帧中间结果
+     */
+    void thresholdHSVUndistorted(const cv::Mat &src, const CameraWrapper &camera, cv::Mat &hsv, cv::Mat &binary) const;
+
+    /**
+     * @brief 颜色阈值调试：由滑动条更新阈值
+     *
+     * @note - 首次调用时向调试输出注册滑动条与窗口布局，之后每帧只读取滑动条的原子值
+     *
+     *       - 滑动条变化时发布新的参数快照，并刷新本帧的参数
+     */
+    void updateColorThresholdFromDebugView();
+
+private:
+    //! 本识别器的参数快照
+    ParamSnapshot_ptr<DetectorParams> __param_snapshot;
+    //! 本帧使用的参数快照
+    std::shared_ptr<const DetectorParams> __params;
+    //! 颜色阈值调试滑动条上一次的取值
+    std::array<int, 6> __hsv_trackbar_values{};
+    //! 颜色阈值调试滑动条 [Lower H, Lower S, Lower V, Upper H, Upper S, Upper V]
+    std::array<DebugViewSink::Trackbar_ptr, 6> __hsv_trackbars;
+
 
 
 };
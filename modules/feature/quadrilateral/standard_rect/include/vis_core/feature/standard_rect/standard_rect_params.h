@@ -0,0 +1,31 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/utils/param_manager/param_manager.h"
+
+/**
+ * @brief 标准矩形识别参数
+ *
+ * @note - 默认构造时读取 yml/DetectorParams.yml
+ *
+ *       - 以配置名构造时读取 yml/DetectorParams_<配置名>.yml，用于多个识别器 (如多相机) 使用不同参数
+ */
+struct DetectorParams
+{
+    //! 白色区域的HSV阈值
+    cv::Scalar lower_hsv = cv::Scalar(0, 0, 200);
+    cv::Scalar upper_hsv = cv::Scalar(180, 25, 255);
+
+    //! 是否启用颜色阈值调试模式
+    bool color_threshold_debug = false;
+
+    //! 相机存在畸变时是否在二值化时融合去畸变 (默认关闭，在畸变空间中二值化)
+    bool undistort_binary = false;
+
+    PARAM_MANAGER_INIT(DetectorParams,
+                       PARAM_MANAGER_ADD_PARAM_RANGE(lower_hsv, 0, 255);
+                       PARAM_MANAGER_ADD_PARAM_RANGE(upper_hsv, 0, 255);
+                       PARAM_MANAGER_ADD_PARAM(color_threshold_debug);
+                       PARAM_MANAGER_ADD_PARAM(undistort_binary););
+};
@@ -1,31 +1,27 @@
 #include "vis_core/feature/standard_rect/standard_rect_detector.h"
-#include "vis_core/utils/param_manager/param_manager.h"
 
 using namespace std;
 using namespace cv;
 
-/**
- * @brief 识别参数
- */
-struct DetectorParams
+StandardRectDetector::Ptr StandardRectDetector::create()
 {
-    //! 白色区域的HSV阈值
-    cv::Scalar lower_hsv = cv::Scalar(0, 0, 200);
-    cv::Scalar upper_hsv = cv::Scalar(180, 25, 255);
-
-    //! 是否启用颜色阈值调试模式
-    bool color_threshold_debug = false;
+    return create(std::string());
+}
 
-    PARAM_MANAGER_INIT(DetectorParams,
-                       PARAM_MANAGER_ADD_PARAM(lower_hsv);
-                       PARAM_MANAGER_ADD_PARAM(upper_hsv);
-                       PARAM_MANAGER_ADD_PARAM(color_threshold_debug););
-};
-inline DetectorParams detector_params;
+StandardRectDetector::Ptr StandardRectDetector::create(const DetectorParams &params)
+{
+    auto instance = make_shared<StandardRectDetector>();
+    instance->__param_snapshot = ParamSnapshot<DetectorParams>::create(params);
+    return instance;
+}
 
-StandardRectDetector::Ptr StandardRectDetector::create()
+StandardRectDetector::Ptr StandardRectDetector::create(const std::string &profile)
 {
-    return make_shared<StandardRectDetector>();
+    auto instance = make_shared<StandardRectDetector>();
+    instance->__param_snapshot = ParamSnapshot<DetectorParams>::create(
+        profile.empty() ? DetectorParams() : DetectorParams(profile));
+    watchParamFile(instance->__param_snapshot);
+    return instance;
 }
 
 auto StandardRectDetector::detect(Img_ptr &img_ptr, const Camera_ptr &camera_ptr) -> std::vector<StandardRect_ptr>
@@ -39,6 +35,17 @@ auto StandardRectDetector::detect(Img_ptr &img_ptr, const Camera_ptr &camera_ptr
 
 auto StandardRectDetector::detectImpl(Img_ptr &img_ptr, const Camera_ptr &camera_ptr) -> std::vector<StandardRect_ptr>
 {
+    // 直接构造 (未经 create) 的识别器使用默认参数
+    if (!__param_snapshot)
+        __param_snapshot = ParamSnapshot<DetectorParams>::create();
+
+    // 帧边界：同步共享参数块中的参数
+    if (isSetSharedParams() && getSharedParams())
+        getSharedParams()->sync(*__param_snapshot);
+
+    // 每帧获取一次参数快照，本帧内的参数保持不变
+    __params = __param_snapshot->load();
+
     // 数据存储
     setSourceImage(img_ptr->img());
     setCamera(camera_ptr);
@@ -50,67 +57,111 @@ auto StandardRectDetector::detectImpl(Img_ptr &img_ptr, const Camera_ptr &camera
 
 
 
-void StandardRectDetector::binarize(Img_ptr &img_ptr)
+void StandardRectDetector::updateColorThresholdFromDebugView()
 {
-    Mat src = img_ptr->img();
-    Mat hsv;
-    cvtColor(src, hsv, COLOR_BGR2HSV);
-    Mat binary;
-    inRange(hsv, detector_params.lower_hsv, detector_params.upper_hsv, binary);
+    if (!isSetDebugSink())
+        setDebugSink(DebugViewSink::instance());
+    const auto &sink = getDebugSink();
 
-    // 颜色阈值调试模式
-    if(detector_params.color_threshold_debug)
+    if (!__hsv_trackbars[0])
     {
-        static bool gui_ready = false;
-
-        // 用 int 数组承接 GUI 数值
-        static int lower_val[3] = {static_cast<int>(detector_params.lower_hsv[0]),
-                                   static_cast<int>(detector_params.lower_hsv[1]),
-                                   static_cast<int>(detector_params.lower_hsv[2])};
+        constexpr int SCR_W = 1920, SCR_H = 1080;
+        sink->setWindowLayout("HSV", cv::Rect(0, 0, SCR_W / 2, SCR_H));
+        sink->setWindowLayout("Binary", cv::Rect(SCR_W / 2, 0, SCR_W / 2, SCR_H));
 
-        static int upper_val[3] = {static_cast<int>(detector_params.upper_hsv[0]),
-                                   static_cast<int>(detector_params.upper_hsv[1]),
-                                   static_cast<int>(detector_params.upper_hsv[2])};
-
-        if (!gui_ready)
+        const char *names[6] = {"Lower H", "Lower S", "Lower V", "Upper H", "Upper S", "Upper V"};
+        const int max_values[6] = {180, 255, 255, 180, 255, 255};
+        for (int i = 0; i < 6; ++i)
         {
-            constexpr int SCR_W = 1920, SCR_H = 1080;
-            cv::namedWindow("HSV", cv::WINDOW_NORMAL);
-            cv::namedWindow("Binary", cv::WINDOW_NORMAL);
-            cv::resizeWindow("HSV", SCR_W / 2, SCR_H);
-            cv::resizeWindow("Binary", SCR_W / 2, SCR_H);
-            cv::moveWindow("HSV", 0, 0);
-            cv::moveWindow("Binary", SCR_W / 2, 0);
-
-            auto addTrack = [&](const std::string &n, int *v, int max)
-            { cv::createTrackbar(n, "HSV", v, max, nullptr); };
-
-            addTrack("Lower H", &lower_val[0], 180);
-            addTrack("Lower S", &lower_val[1], 255);
-            addTrack("Lower V", &lower_val[2], 255);
-            addTrack("Upper H", &upper_val[0], 180);
-            addTrack("Upper S", &upper_val[1], 255);
-            addTrack("Upper V", &upper_val[2], 255);
-
-            gui_ready = true;
+            const auto &hsv = (i < 3) ? __params->lower_hsv : __params->upper_hsv;
+            __hsv_trackbar_values[i] = static_cast<int>(hsv[i % 3]);
+            __hsv_trackbars[i] = sink->addTrackbar("HSV", names[i], __hsv_trackbar_values[i], max_values[i]);
         }
+    }
 
-        // 打印当前阈值
-        std::cout << "Lower HSV: " << detector_params.lower_hsv << std::endl;
-        std::cout << "Upper HSV: " << detector_params.upper_hsv << std::endl;
+    // 仅在滑动条被拖动时发布新快照，避免覆盖由文件重新加载的参数
+    bool changed = false;
+    for (int i = 0; i < 6; ++i)
+    {
+        const int value = __hsv_trackbars[i]->value();
+        changed |= (value != __hsv_trackbar_values[i]);
+        __hsv_trackbar_values[i] = value;
+    }
+    if (!changed)
+        return;
+
+    const auto &v = __hsv_trackbar_values;
+    __param_snapshot->update([&v](DetectorParams &params)
+                             {
+        params.lower_hsv = cv::Scalar(v[0], v[1], v[2]);
+        params.upper_hsv = cv::Scalar(v[3], v[4], v[5]); });
+    __params = __param_snapshot->load();
+}
 
-        /* 3-2. 每帧把 GUI → Scalar，再 inRange、显示 */
-        detector_params.lower_hsv = cv::Scalar(lower_val[0], lower_val[1], lower_val[2]);
-        detector_params.upper_hsv = cv::Scalar(upper_val[0], upper_val[1], upper_val[2]);
+void StandardRectDetector::binarize(Img_ptr &img_ptr)
+{
+    // 颜色阈值调试模式：先由滑动条更新阈值，再统一二值化
+    if (__params->color_threshold_debug)
+        updateColorThresholdFromDebugView();
 
-        cv::inRange(hsv, detector_params.lower_hsv, detector_params.upper_hsv, binary);
-        cv::imshow("HSV", hsv);
-        cv::imshow("Binary", binary);
+    Mat src = img_ptr->img();
+    const auto &camera = getCamera();
+    const bool fused = __params->undistort_binary && camera && camera->hasDistortion() &&
+                       src.cols == camera->imageSize().width && src.rows == camera->imageSize().height;
+
+    Mat hsv, binary;
+    if (fused)
+        thresholdHSVUndistorted(src, *camera, hsv, binary);
+    else
+        thresholdHSV(src, hsv, binary);
+    setBinaryUndistorted(fused);
+
+    if (__params->color_threshold_debug)
+    {
+        // 阈值以文字叠加在二值图上，由调试输出的消费线程绘制
+        DrawBuffer overlay;
+        char text[96];
+        snprintf(text, sizeof(text), "Lower HSV: [%d, %d, %d]", static_cast<int>(__params->lower_hsv[0]),
+                 static_cast<int>(__params->lower_hsv[1]), static_cast<int>(__params->lower_hsv[2]));
+        overlay.addText(text, cv::Point2f(10, 30), 0.8, cv::Scalar(0, 0, 255), 2);
+        snprintf(text, sizeof(text), "Upper HSV: [%d, %d, %d]", static_cast<int>(__params->upper_hsv[0]),
+                 static_cast<int>(__params->upper_hsv[1]), static_cast<int>(__params->upper_hsv[2]));
+        overlay.addText(text, cv::Point2f(10, 60), 0.8, cv::Scalar(0, 0, 255), 2);
+
+        const auto &sink = getDebugSink();
+        sink->push("HSV", hsv);
+        sink->push("Binary", binary, std::move(overlay));
     }
 
-    // 对 binary 图像做腐蚀处理
+    // 对 binary 图像做腐蚀处理 (输出到新图像，不修改已投递给调试输出的数据)
     Mat kernel = getStructuringElement(MORPH_RECT, Size(3, 3));
-    erode(binary, binary, kernel, Point(-1, -1), 3);
-    img_ptr->setImg("binary", binary);
+    Mat eroded;
+    erode(binary, eroded, kernel, Point(-1, -1), 3);
+    img_ptr->setImg("binary", eroded);
     img_ptr->setImg("hsv", hsv);
-}
\ No newline at end of file
+}
+
+void StandardRectDetector::thresholdHSV(const Mat &src, Mat &hsv, Mat &binary) const
+{
+    cvtColor(src, hsv, COLOR_BGR2HSV);
+    inRange(hsv, __params->lower_hsv, __params->upper_hsv, binary);
+}
+
+void StandardRectDetector::thresholdHSVUndistorted(const Mat &src, const CameraWrapper &camera, Mat &hsv, Mat &binary) const
+{
+    const auto &maps = camera.undistortMaps();
+    hsv.create(src.rows, src.cols, CV_8UC3);
+    binary.create(src.rows, src.cols, CV_8UC1);
+
+    // 条带缓冲区足够小，remap 的结果在缓存中被颜色转换与阈值化直接消费
+    Mat strip;
+    for (int row = 0; row < src.rows; row += FUSED_STRIP_ROWS)
+    {
+        const Range rows(row, std::min(row + FUSED_STRIP_ROWS, src.rows));
+        remap(src, strip, maps.map1.rowRange(rows), maps.map2.rowRange(rows), INTER_LINEAR);
+        Mat hsv_strip = hsv.rowRange(rows);
+        Mat binary_strip = binary.rowRange(rows);
+        cvtColor(strip, hsv_strip, COLOR_BGR2HSV);
+        inRange(hsv_strip, __params->lower_hsv, __params->upper_hsv, binary_strip);
+    }
+}
@@ -0,0 +1,134 @@
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/math/pose_proc/batch_transform.hpp"
+
+/**
+ * @brief 批量位姿变换的正确性测试
+ *
+ * 1. fold 折叠的变换链与逐个 operator+ 复合的结果一致 (span 与可变参数两种形式)
+ * 2. 交错存储与 SoA 的批量变换在各种点数 (含奇数，覆盖 SIMD 主循环后的标量尾部) 下与逐点标量计算一致
+ * 3. 输入输出为同一数组时结果不变
+ */
+
+constexpr double FOLD_TOLERANCE = 1e-9;  //!< 变换链折叠的允许误差
+constexpr double POINT_TOLERANCE = 1e-9; //!< 点变换的允许误差 (FMA 与普通乘加的舍入差异)
+
+static std::mt19937 rng(20240611);
+
+static Transform6D randomTransform()
+{
+    std::uniform_real_distribution<double> angle(-1.5, 1.5), offset(-5.0, 5.0);
+    return Transform6D(cv::Vec3d(angle(rng), angle(rng), angle(rng)), cv::Vec3d(offset(rng), offset(rng), offset(rng)));
+}
+
+static double maxDiff(const pose_batch::AffineType &a, const pose_batch::AffineType &b)
+{
+    double diff = 0;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 4; ++j)
+            diff = std::max(diff, std::abs(a(i, j) - b(i, j)));
+    return diff;
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what, std::size_t n)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s (n = %zu)\n", what, n);
+            ++failures;
+        }
+    };
+
+    // ---------------- fold 与 operator+ ----------------
+    for (std::size_t length = 0; length <= 6; ++length)
+    {
+        for (int trial = 0; trial < 20; ++trial)
+        {
+            std::vector<Transform6D> chain;
+            Transform6D chained;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                chain.push_back(randomTransform());
+                chained = (i == 0) ? chain[0] : chained + chain[i];
+            }
+            const auto folded = pose_batch::fold(std::span<const Transform6D>(chain));
+            check(maxDiff(folded, pose_batch::toAffine(chained)) < FOLD_TOLERANCE, "fold(span) != operator+", length);
+        }
+    }
+    {
+        const Transform6D a = randomTransform(), b = randomTransform(), c = randomTransform();
+        check(maxDiff(pose_batch::fold(a, b, c), pose_batch::toAffine(a + b + c)) < FOLD_TOLERANCE, "fold(a, b, c) != a + b + c", 3);
+        check(maxDiff(pose_batch::fold(a), pose_batch::toAffine(a)) < FOLD_TOLERANCE, "fold(a) != a", 1);
+    }
+
+    // ---------------- SIMD 主循环与标量尾部 ----------------
+    const auto m = pose_batch::fold(randomTransform(), randomTransform());
+    std::uniform_real_distribution<double> coord(-10.0, 10.0);
+    for (std::size_t n : {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 15u, 16u, 17u, 63u, 64u, 65u, 1001u})
+    {
+        std::vector<cv::Point3d> src(n);
+        for (auto &p : src)
+            p = cv::Point3d(coord(rng), coord(rng), coord(rng));
+
+        // 逐点标量参考结果
+        std::vector<cv::Point3d> expected(n);
+        for (std::size_t i = 0; i < n; ++i)
+            pose_batch::detail::transformOne(m, src[i].x, src[i].y, src[i].z, expected[i].x, expected[i].y, expected[i].z);
+
+        auto near = [](const cv::Point3d &a, const cv::Point3d &b)
+        {
+            return std::abs(a.x - b.x) < POINT_TOLERANCE && std::abs(a.y - b.y) < POINT_TOLERANCE &&
+                   std::abs(a.z - b.z) < POINT_TOLERANCE;
+        };
+
+        // 交错存储
+        const auto interleaved = pose_batch::transformPoints(m, src);
+        bool same = interleaved.size() == n;
+        for (std::size_t i = 0; same && i < n; ++i)
+            same = near(interleaved[i], expected[i]);
+        check(same, "interleaved != scalar", n);
+
+        // 原地变换
+        std::vector<cv::Point3d> inplace = src;
+        pose_batch::transformPoints<cv::Point3d>(m, std::span<const cv::Point3d>(inplace), std::span<cv::Point3d>(inplace));
+        same = true;
+        for (std::size_t i = 0; same && i < n; ++i)
+            same = near(inplace[i], expected[i]);
+        check(same, "in-place interleaved != scalar", n);
+
+        // cv::Vec3d
+        std::vector<cv::Vec3d> vec_src(n);
+        for (std::size_t i = 0; i < n; ++i)
+            vec_src[i] = cv::Vec3d(src[i].x, src[i].y, src[i].z);
+        const auto vec_dst = pose_batch::transformPoints(m, vec_src);
+        same = true;
+        for (std::size_t i = 0; same && i < n; ++i)
+            same = near(cv::Point3d(vec_dst[i][0], vec_dst[i][1], vec_dst[i][2]), expected[i]);
+        check(same, "Vec3d != scalar", n);
+
+        // SoA
+        pose_batch::PointCloudSoA cloud{std::span<const cv::Point3d>(src)}, cloud_out;
+        pose_batch::transformPoints(m, cloud, cloud_out);
+        same = cloud_out.size() == n;
+        for (std::size_t i = 0; same && i < n; ++i)
+            same = near(cv::Point3d(cloud_out.x[i], cloud_out.y[i], cloud_out.z[i]), expected[i]);
+        check(same, "SoA != scalar", n);
+
+        pose_batch::transformPoints(m, cloud, cloud);
+        same = cloud.size() == n;
+        for (std::size_t i = 0; same && i < n; ++i)
+            same = near(cv::Point3d(cloud.x[i], cloud.y[i], cloud.z[i]), expected[i]);
+        check(same, "in-place SoA != scalar", n);
+    }
+
+    std::printf("%s (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core.hpp>
+
+#include "vis_core/utils/camera/camera_wrapper.h"
+
+/**
+ * @brief CameraWrapper::project 批量投影的吞吐量与正确性
+ *
+ * 1. 有畸变与无畸变相机下，分别计时 CameraWrapper::project 与 cv::projectPoints
+ * 2. 与逐点标量公式、cv::projectPoints 的结果比较，偏差超过允许误差时返回非零
+ * 3. 点数为奇数时校验尾部的标量路径
+ */
+
+constexpr int COUNT = 4097;            //!< 三维点数量 (奇数，覆盖尾部)
+constexpr int ROUNDS = 200;            //!< 重复次数
+constexpr double TOLERANCE = 1e-6;     //!< 允许的像素偏差
+
+template <typename Func>
+static double nsPerPoint(Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(ROUNDS) * COUNT);
+}
+
+/**
+ * @brief 逐点标量参考实现 (针孔模型 + 5 参数畸变)
+ */
+static cv::Point2d projectReference(const cv::Matx33d &K, const cv::Matx51d &D, const Transform6D &pose, const cv::Point3d &p)
+{
+    const cv::Vec3d c = pose.rmat() * cv::Vec3d(p.x, p.y, p.z) + pose.tvec();
+    const double x = c(0) / c(2), y = c(1) / c(2);
+    const double r2 = x * x + y * y;
+    const double radial = 1 + D(0) * r2 + D(1) * r2 * r2 + D(4) * r2 * r2 * r2;
+    const double xd = x * radial + 2 * D(2) * x * y + D(3) * (r2 + 2 * x * x);
+    const double yd = y * radial + D(2) * (r2 + 2 * y * y) + 2 * D(3) * x * y;
+    return cv::Point2d(K(0, 0) * xd + K(0, 2), K(1, 1) * yd + K(1, 2));
+}
+
+static double maxDeviation(const std::vector<cv::Point2d> &a, const std::vector<cv::Point2d> &b)
+{
+    double deviation = 0;
+    for (size_t i = 0; i < a.size(); ++i)
+        deviation = std::max(deviation, std::max(std::abs(a[i].x - b[i].x), std::abs(a[i].y - b[i].y)));
+    return deviation;
+}
+
+int main()
+{
+    const cv::Matx33f K(1000, 0, 640,
+                        0, 1000, 512,
+                        0, 0, 1);
+    const cv::Matx51f distorted(-0.08f, 0.05f, 0.001f, -0.0005f, 0.01f);
+    const Transform6D pose(cv::Vec3d(0.1, -0.2, 0.05), cv::Vec3d(0.05, -0.02, 3.0));
+
+    std::mt19937 rng(50);
+    std::uniform_real_distribution<double> lateral(-1.0, 1.0), depth(-0.5, 0.5);
+    std::vector<cv::Point3d> points(COUNT);
+    for (auto &p : points)
+        p = cv::Point3d(lateral(rng), lateral(rng), depth(rng));
+
+    bool ok = true;
+    double sink = 0;
+    const cv::Vec3d rvec = pose.rvec(), tvec = pose.tvec();
+    for (bool with_distortion : {true, false})
+    {
+        const cv::Matx51f D = with_distortion ? distorted : cv::Matx51f::zeros();
+        auto camera = CameraWrapper::create(K, D);
+
+        std::vector<cv::Point2d> pixels(COUNT), opencv(COUNT), reference(COUNT);
+        const double wrapper_ns = nsPerPoint([&] {
+            camera->project(std::span<const cv::Point3d>(points), pose, std::span<cv::Point2d>(pixels));
+            sink += pixels[0].x;
+        });
+        const double opencv_ns = nsPerPoint([&] {
+            cv::projectPoints(points, rvec, tvec, K, D, opencv);
+            sink += opencv[0].x;
+        });
+
+        for (int i = 0; i < COUNT; ++i)
+            reference[i] = projectReference(cv::Matx33d(K), cv::Matx51d(D), pose, points[i]);
+        const double reference_deviation = maxDeviation(pixels, reference);
+        const double opencv_deviation = maxDeviation(pixels, opencv);
+        ok &= reference_deviation < TOLERANCE && opencv_deviation < TOLERANCE;
+
+        std::printf("%-14s project %6.2f ns/point   cv::projectPoints %6.2f ns/point   x%.2f\n",
+                    with_distortion ? "distorted" : "undistorted", wrapper_ns, opencv_ns,
+                    wrapper_ns > 0 ? opencv_ns / wrapper_ns : 0.0);
+        std::printf("%-14s max deviation: reference %.2e px   cv::projectPoints %.2e px\n", "", reference_deviation, opencv_deviation);
+    }
+
+    std::printf("(sink %.3f)\n", sink);
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
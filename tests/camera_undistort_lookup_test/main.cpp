@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/utils/camera/camera_wrapper.h"
+
+/**
+ * @brief CameraWrapper::lookupNormalized 查表去畸变与迭代去畸变的一致性测试
+ *
+ * 1. 图像内逐像素 (含半像素位置) 比较查表结果与 undistortNormalized 的高迭代次数参考值，
+ *    覆盖图像宽高不是 GRID_STEP 整数倍时的边缘网格单元与 [width, height] 边界
+ * 2. 图像外的点回退到 undistortNormalized，结果完全一致
+ * 3. 批量接口与逐点接口的结果一致
+ * 4. 无畸变、图像尺寸未知时直接使用 undistortNormalized
+ */
+
+constexpr int REFERENCE_ITERATIONS = 30; //!< 参考值的迭代次数
+constexpr double TOLERANCE = 0.01;       //!< 查表结果允许的偏差 (像素)
+
+/**
+ * @brief 查表结果与参考值的偏差 (像素)
+ */
+static double deviation(const CameraWrapper &camera, const cv::Point2d &pixel)
+{
+    const cv::Point2d lookup = camera.lookupNormalized(pixel);
+    const cv::Point2d reference = camera.undistortNormalized(pixel, REFERENCE_ITERATIONS);
+    return std::max(std::abs(lookup.x - reference.x) * camera.cameraMatrix()(0, 0),
+                    std::abs(lookup.y - reference.y) * camera.cameraMatrix()(1, 1));
+}
+
+static bool same(const cv::Point2d &a, const cv::Point2d &b) { return a.x == b.x && a.y == b.y; }
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    const cv::Matx33f K(1000, 0, 640,
+                        0, 1000, 512,
+                        0, 0, 1);
+    const cv::Matx51f D(-0.08f, 0.05f, 0.001f, -0.0005f, 0.01f);
+
+    // 1280 x 1024 为 GRID_STEP 的整数倍，1283 x 1021 的最后一列、一行网格单元不完整
+    for (const cv::Size size : {cv::Size(1280, 1024), cv::Size(1283, 1021)})
+    {
+        auto camera = CameraWrapper::create(K, D, size);
+        const double w = size.width, h = size.height;
+
+        // ---------------- 1. 图像内逐像素 ----------------
+        double max_inside = 0;
+        cv::Point2d worst;
+        for (double y = 0; y <= h; y += 0.5)
+        {
+            for (double x = 0; x <= w; x += 0.5)
+            {
+                const double d = deviation(*camera, cv::Point2d(x, y));
+                if (d > max_inside)
+                {
+                    max_inside = d;
+                    worst = cv::Point2d(x, y);
+                }
+            }
+        }
+        // 边缘网格单元内的非半像素位置与边界
+        double max_edge = 0;
+        for (double t : {0.0, 0.01, 0.37, 0.5, 0.99})
+        {
+            for (double x : {t, w - 1 + t, w - t})
+                for (double y = 0; y <= h; y += 1.0)
+                    max_edge = std::max(max_edge, deviation(*camera, cv::Point2d(x, y)));
+            for (double y : {t, h - 1 + t, h - t})
+                for (double x = 0; x <= w; x += 1.0)
+                    max_edge = std::max(max_edge, deviation(*camera, cv::Point2d(x, y)));
+        }
+        std::printf("%d x %d : max deviation inside %.2e px at (%.1f, %.1f)   edges %.2e px\n", size.width, size.height,
+                    max_inside, worst.x, worst.y, max_edge);
+        check(max_inside < TOLERANCE, "图像内查表结果与迭代去畸变一致");
+        check(max_edge < TOLERANCE, "边缘网格单元与图像边界的查表结果与迭代去畸变一致");
+
+        // ---------------- 2. 图像外回退 ----------------
+        const int step = CameraWrapper::GRID_STEP;
+        const std::vector<cv::Point2d> outside = {
+            {-0.5, 100}, {100, -0.5}, {-1e-9, -1e-9}, {-200, -300}, {w + 4 * step, h / 2}, {w / 2, h + 4 * step},
+            {w + 1000, h + 1000}, {-1e4, 1e4}, {w * 3, -h}};
+        bool fallback = true;
+        for (const auto &pixel : outside)
+            fallback &= same(camera->lookupNormalized(pixel), camera->undistortNormalized(pixel));
+        check(fallback, "图像外的点回退到 undistortNormalized");
+
+        // ---------------- 3. 批量接口 ----------------
+        std::vector<cv::Point2f> pixels;
+        for (double y = -20; y <= h + 20; y += 37.3)
+            for (double x = -20; x <= w + 20; x += 41.7)
+                pixels.emplace_back(static_cast<float>(x), static_cast<float>(y));
+        std::vector<cv::Point2d> normalized;
+        camera->lookupNormalized(pixels, normalized);
+        bool batch = normalized.size() == pixels.size();
+        for (std::size_t i = 0; batch && i < pixels.size(); ++i)
+            batch = same(normalized[i], camera->lookupNormalized(cv::Point2d(pixels[i])));
+        check(batch, "批量接口与逐点接口的结果一致");
+    }
+
+    // ---------------- 4. 无畸变、图像尺寸未知 ----------------
+    auto undistorted = CameraWrapper::create(K, cv::Matx51f::zeros(), cv::Size(1280, 1024));
+    auto unsized = CameraWrapper::create(K, D);
+    bool direct = true;
+    for (const cv::Point2d pixel : {cv::Point2d(0, 0), cv::Point2d(640.5, 511.25), cv::Point2d(1279, 1023), cv::Point2d(-50, 2000)})
+    {
+        direct &= same(undistorted->lookupNormalized(pixel), undistorted->undistortNormalized(pixel));
+        direct &= same(unsized->lookupNormalized(pixel), unsized->undistortNormalized(pixel));
+    }
+    check(direct, "无畸变或图像尺寸未知时直接使用 undistortNormalized");
+
+    if (failures == 0)
+        std::printf("PASS\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/visual/contour_proc/contour_wrapper.hpp"
+#include "vis_core/visual/contour_proc/contour_hierarchy.hpp"
+
+/**
+ * @brief 扁平轮廓层级与 unordered_map 轮廓层级的构建、遍历耗时对比
+ *
+ * 以 10k 个轮廓的合成层级 (与 cv::findContours 输出格式一致) 为输入，
+ * 分别统计两种层级表示的构建耗时与以下遍历的耗时，并校验两者结果一致:
+ *
+ * 1. 子轮廓遍历 2. 深度优先遍历 3. 指定深度查询 4. "恰有一个子轮廓" 筛选
+ */
+
+using MapTuple = std::unordered_map<ContourI_ptr, std::tuple<ContourI_ptr, ContourI_ptr, ContourI_ptr, ContourI_ptr>>;
+using MapArray = std::unordered_map<ContourI_ptr, std::array<ContourI_ptr, 4>>;
+
+constexpr int CONTOUR_COUNT = 10000; //!< 轮廓数量
+constexpr int ROUNDS = 20;           //!< 每项测试重复次数
+
+/**
+ * @brief 生成与 cv::findContours(RETR_TREE) 输出格式一致的层级
+ *
+ * @note 每个轮廓的父轮廓由确定性伪随机序列给出，最大深度为 4
+ */
+static std::vector<cv::Vec4i> makeHierarchy(int count)
+{
+    std::vector<int> parent(count, -1), depth(count, 0);
+    unsigned state = 12345u;
+    for (int i = 0; i < count; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        int candidate = i > 0 ? static_cast<int>((state >> 8) % static_cast<unsigned>(i)) : -1;
+        if (i % 4 == 0 || candidate < 0 || depth[candidate] >= 4)
+            continue;
+        parent[i] = candidate;
+        depth[i] = depth[candidate] + 1;
+    }
+    std::vector<cv::Vec4i> hierarchy(count, cv::Vec4i(-1, -1, -1, -1));
+    std::vector<int> last_child(count, -1);
+    int last_root = -1;
+    for (int i = 0; i < count; ++i)
+    {
+        int p = parent[i];
+        int &last = p < 0 ? last_root : last_child[p];
+        hierarchy[i][3] = p;
+        hierarchy[i][1] = last;
+        if (last >= 0)
+            hierarchy[last][0] = i;
+        else if (p >= 0)
+            hierarchy[p][2] = i;
+        last = i;
+    }
+    return hierarchy;
+}
+
+template <typename Func>
+static double measure(Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / ROUNDS;
+}
+
+static void report(const char *name, double flat_us, double map_us)
+{
+    std::printf("%-24s flat %10.1f us   map %10.1f us   x%.1f\n", name, flat_us, map_us,
+                flat_us > 0 ? map_us / flat_us : 0.0);
+}
+
+int main()
+{
+    const auto hierarchy_vec = makeHierarchy(CONTOUR_COUNT);
+    std::vector<ContourI_ptr> contours;
+    contours.reserve(CONTOUR_COUNT);
+    for (int i = 0; i < CONTOUR_COUNT; ++i)
+    {
+        std::vector<cv::Point> points = {{i, 0}, {i + 4, 0}, {i + 4, 4}, {i, 4}};
+        contours.emplace_back(ContourWrapper<int>::create(std::move(points)));
+    }
+    std::unordered_map<const ContourWrapper<int> *, int> index_of;
+    for (int i = 0; i < CONTOUR_COUNT; ++i)
+        index_of[contours[i].get()] = i;
+    auto at = [&](int i) { return i != -1 ? contours[i] : nullptr; };
+
+    bool ok = true;
+    auto check = [&](bool cond, const char *what) {
+        if (!cond)
+        {
+            std::printf("MISMATCH: %s\n", what);
+            ok = false;
+        }
+    };
+
+    // ---------------- 构建 ----------------
+    ContourHierarchy flat;
+    MapTuple map_tuple;
+    MapArray map_array;
+    double flat_build = measure([&] { flat.assign(hierarchy_vec); });
+    double tuple_build = measure([&] {
+        map_tuple.clear();
+        map_tuple.reserve(contours.size());
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            const auto &h = hierarchy_vec[i];
+            map_tuple[contours[i]] = std::make_tuple(at(h[0]), at(h[1]), at(h[2]), at(h[3]));
+        }
+    });
+    double array_build = measure([&] {
+        map_array.clear();
+        map_array.reserve(contours.size());
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            const auto &h = hierarchy_vec[i];
+            map_array[contours[i]] = {at(h[0]), at(h[1]), at(h[2]), at(h[3])};
+        }
+    });
+    report("build (tuple map)", flat_build, tuple_build);
+    report("build (array map)", flat_build, array_build);
+
+    // ---------------- 子轮廓遍历 ----------------
+    long long flat_children = 0, map_children = 0;
+    double flat_child_us = measure([&] {
+        flat_children = 0;
+        for (int i = 0; i < CONTOUR_COUNT; ++i)
+            for (int c : flat.children(i))
+                flat_children += c;
+    });
+    double map_child_us = measure([&] {
+        map_children = 0;
+        for (const auto &contour : contours)
+            for (auto c = std::get<2>(map_tuple.at(contour)); c; c = std::get<0>(map_tuple.at(c)))
+                map_children += index_of.at(c.get());
+    });
+    report("children", flat_child_us, map_child_us);
+    check(flat_children == map_children, "children");
+
+    // ---------------- 深度优先遍历 ----------------
+    long long flat_dfs = 0, map_dfs = 0;
+    double flat_dfs_us = measure([&] {
+        flat_dfs = 0;
+        int order = 0;
+        for (int i : flat.depthFirst())
+            flat_dfs += static_cast<long long>(i) * ++order;
+    });
+    std::vector<ContourI_ptr> stack;
+    double map_dfs_us = measure([&] {
+        map_dfs = 0;
+        int order = 0;
+        stack.clear();
+        std::vector<ContourI_ptr> roots;
+        for (int i = 0; i < CONTOUR_COUNT; ++i)
+            if (hierarchy_vec[i][3] == -1)
+                roots.push_back(contours[i]);
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+            stack.push_back(*it);
+        while (!stack.empty())
+        {
+            auto cur = std::move(stack.back());
+            stack.pop_back();
+            map_dfs += static_cast<long long>(index_of.at(cur.get())) * ++order;
+            std::vector<ContourI_ptr> kids;
+            for (auto c = std::get<2>(map_tuple.at(cur)); c; c = std::get<0>(map_tuple.at(c)))
+                kids.push_back(c);
+            for (auto it = kids.rbegin(); it != kids.rend(); ++it)
+                stack.push_back(*it);
+        }
+    });
+    report("depth first", flat_dfs_us, map_dfs_us);
+    check(flat_dfs == map_dfs, "depth first");
+
+    // ---------------- 指定深度查询 ----------------
+    std::vector<int> flat_depth;
+    std::vector<int> map_depth;
+    double flat_depth_us = measure([&] { flat.atDepth(2, flat_depth); });
+    double map_depth_us = measure([&] {
+        map_depth.clear();
+        for (int i = 0; i < CONTOUR_COUNT; ++i)
+        {
+            int d = 0;
+            for (auto p = std::get<3>(map_tuple.at(contours[i])); p; p = std::get<3>(map_tuple.at(p)))
+                ++d;
+            if (d == 2)
+                map_depth.push_back(i);
+        }
+    });
+    report("at depth 2", flat_depth_us, map_depth_us);
+    check(flat_depth == map_depth, "at depth");
+
+    // ---------------- 恰有一个子轮廓 ----------------
+    std::vector<int> flat_single;
+    std::vector<int> map_single;
+    double flat_single_us = measure([&] {
+        flat.select([](const ContourHierarchy::Node &node) { return node.child_count == 1; }, flat_single);
+    });
+    double map_single_us = measure([&] {
+        map_single.clear();
+        for (int i = 0; i < CONTOUR_COUNT; ++i)
+        {
+            const auto &child = std::get<2>(map_tuple.at(contours[i]));
+            if (child && !std::get<0>(map_tuple.at(child)))
+                map_single.push_back(i);
+        }
+    });
+    report("single child", flat_single_us, map_single_us);
+    check(flat_single == map_single, "single child");
+
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
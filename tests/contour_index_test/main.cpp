@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/visual/contour_proc/contour_index.hpp"
+
+/**
+ * @brief 轮廓空间索引与暴力查询的一致性测试
+ *
+ * 1. 轮廓组混合矩形、L 形、U 形 (质心远离包围盒中心) 与面积为 0 的线状轮廓 (质心退化)
+ * 2. Grid、RTree、Auto 三种后端的半径查询、包围盒重叠查询、k 近邻查询与邻近配对均与暴力查询一致
+ * 3. 输入轮廓组释放后，索引仍可返回轮廓指针
+ */
+
+using Index = ContourSpatialIndex<int>;
+
+constexpr int QUERIES = 300;      //!< 每种后端的随机查询次数
+constexpr float WORLD = 1000.f;   //!< 轮廓分布范围
+
+static std::mt19937 rng(30);
+
+static int randomInt(int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); }
+
+/**
+ * @brief 生成随机轮廓：矩形、L 形、U 形或线段
+ */
+static ContourI_ptr randomContour(int max_size)
+{
+    const int x = randomInt(0, static_cast<int>(WORLD)), y = randomInt(0, static_cast<int>(WORLD));
+    const int w = randomInt(4, max_size), h = randomInt(4, max_size);
+    const int t = std::max(1, std::min(w, h) / 5); // L、U 形的臂宽
+    switch (randomInt(0, 3))
+    {
+    case 0:
+        return ContourWrapper<int>::create(std::vector<cv::Point>{{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}});
+    case 1:
+        return ContourWrapper<int>::create(std::vector<cv::Point>{
+            {x, y}, {x + t, y}, {x + t, y + h - t}, {x + w, y + h - t}, {x + w, y + h}, {x, y + h}});
+    case 2:
+        return ContourWrapper<int>::create(std::vector<cv::Point>{
+            {x, y}, {x + t, y}, {x + t, y + h - t}, {x + w - t, y + h - t}, {x + w - t, y}, {x + w, y}, {x + w, y + h}, {x, y + h}});
+    default:
+        return ContourWrapper<int>::create(std::vector<cv::Point>{{x, y}, {x + w, y + h}});
+    }
+}
+
+/**
+ * @brief 索引使用的轮廓位置：质心，不在包围盒内时为包围盒中心
+ */
+static cv::Point2f referenceCenter(const ContourI_ptr &contour)
+{
+    const cv::Rect2f box(contour->boundingRect());
+    const auto c = contour->center();
+    const cv::Point2f center(static_cast<float>(c.x), static_cast<float>(c.y));
+    if (center.x >= box.x && center.x <= box.x + box.width && center.y >= box.y && center.y <= box.y + box.height)
+        return center;
+    return cv::Point2f(box.x + 0.5f * box.width, box.y + 0.5f * box.height);
+}
+
+static float squaredDistance(const cv::Point2f &a, const cv::Point2f &b)
+{
+    const float dx = a.x - b.x, dy = a.y - b.y;
+    return dx * dx + dy * dy;
+}
+
+static bool overlaps(const cv::Rect2f &a, const cv::Rect2f &b)
+{
+    return a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    // 稠密小轮廓 (网格适用) 与稀疏大轮廓 (R 树适用) 两组数据
+    for (const auto &[count, max_size] : {std::pair{600, 40}, std::pair{40, 300}})
+    {
+        Index::ContourGroup contours;
+        for (int i = 0; i < count; ++i)
+            contours.push_back(randomContour(max_size));
+        std::vector<cv::Point2f> centers;
+        for (const auto &contour : contours)
+            centers.push_back(referenceCenter(contour));
+
+        for (auto backend : {Index::Backend::Grid, Index::Backend::RTree, Index::Backend::Auto})
+        {
+            Index index(contours, backend);
+            int radius_mismatch = 0, box_mismatch = 0, knn_mismatch = 0;
+            std::vector<size_t> got, expected;
+            for (int q = 0; q < QUERIES; ++q)
+            {
+                const cv::Point2f p(static_cast<float>(randomInt(-100, 1100)), static_cast<float>(randomInt(-100, 1100)));
+                const float r = static_cast<float>(randomInt(0, 150));
+
+                got.clear();
+                expected.clear();
+                index.radiusSearch(p, r, got);
+                for (size_t i = 0; i < contours.size(); ++i)
+                    if (squaredDistance(centers[i], p) <= r * r)
+                        expected.push_back(i);
+                std::sort(got.begin(), got.end());
+                radius_mismatch += got != expected;
+
+                const cv::Rect2f box(p.x, p.y, r, 0.5f * r);
+                got.clear();
+                expected.clear();
+                index.boxSearch(box, got);
+                for (size_t i = 0; i < contours.size(); ++i)
+                    if (overlaps(cv::Rect2f(contours[i]->boundingRect()), box))
+                        expected.push_back(i);
+                std::sort(got.begin(), got.end());
+                box_mismatch += got != expected;
+
+                const size_t k = static_cast<size_t>(randomInt(1, 8));
+                index.knnSearch(p, k, got);
+                std::vector<float> distances;
+                for (const auto &center : centers)
+                    distances.push_back(squaredDistance(center, p));
+                std::vector<float> sorted = distances;
+                std::sort(sorted.begin(), sorted.end());
+                bool knn_ok = got.size() == std::min(k, contours.size());
+                for (size_t j = 0; knn_ok && j < got.size(); ++j)
+                    knn_ok = std::abs(distances[got[j]] - sorted[j]) <= 1e-3f * std::max(1.f, sorted[j]);
+                knn_mismatch += !knn_ok;
+            }
+
+            std::vector<std::pair<size_t, size_t>> pairs, expected_pairs;
+            index.neighborPairs(30.f, pairs);
+            for (size_t i = 0; i < contours.size(); ++i)
+                for (size_t j = i + 1; j < contours.size(); ++j)
+                    if (squaredDistance(centers[i], centers[j]) <= 30.f * 30.f)
+                        expected_pairs.emplace_back(i, j);
+            std::sort(pairs.begin(), pairs.end());
+
+            const char *name = index.backend() == Index::Backend::Grid ? "Grid" : "RTree";
+            std::printf("%4d contours  %-5s  radius %d  box %d  knn %d mismatches  pairs %zu\n", count, name,
+                        radius_mismatch, box_mismatch, knn_mismatch, pairs.size());
+            check(radius_mismatch == 0, "半径查询与暴力查询一致");
+            check(box_mismatch == 0, "包围盒重叠查询与暴力查询一致");
+            check(knn_mismatch == 0, "k 近邻查询与暴力查询一致");
+            check(pairs == expected_pairs, "邻近配对与暴力查询一致");
+        }
+    }
+
+    // ---------------- 输入轮廓组的生命周期 ----------------
+    Index index;
+    {
+        Index::ContourGroup contours;
+        for (int i = 0; i < 100; ++i)
+            contours.push_back(randomContour(40));
+        index.build(contours);
+    }
+    const auto all = index.boxSearch(cv::Rect2f(-100.f, -100.f, WORLD + 200.f, WORLD + 200.f));
+    bool alive = all.size() == 100;
+    for (const auto &contour : all)
+        alive &= contour && contour->boundingRect().area() >= 0;
+    check(alive, "输入轮廓组释放后索引仍持有轮廓");
+
+    if (failures == 0)
+        std::printf("PASS\n");
+    return failures == 0 ? 0 : 1;
+}
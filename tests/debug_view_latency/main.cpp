@@ -0,0 +1,104 @@
+#include <opencv2/opencv.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "vis_core/utils/debug_view/debug_view.h"
+
+/**
+ * @brief 调试可视化对识别线程延迟的影响
+ *
+ * 以与 StandardRectDetector::binarize 相同的处理流程 (HSV 转换、阈值、腐蚀) 为负载，
+ * 交替测量关闭与开启调试投递 (含叠加文字构建与两次 push) 时每帧的耗时，
+ * 取各轮中位数比较，延迟增加超过 2% 时返回非零
+ *
+ * 用法: debug_view_latency [auto|display|sequence|video|discard]
+ */
+
+constexpr int IMAGE_WIDTH = 1280;      //!< 图像宽度
+constexpr int IMAGE_HEIGHT = 1024;     //!< 图像高度
+constexpr int FRAMES_PER_BLOCK = 30;   //!< 每轮帧数
+constexpr int BLOCKS = 10;             //!< 每种模式的轮数
+constexpr double MAX_OVERHEAD = 0.02;  //!< 允许的延迟增加比例
+
+static DebugViewOutput parseOutput(const char *name)
+{
+    if (std::strcmp(name, "display") == 0)
+        return DebugViewOutput::Display;
+    if (std::strcmp(name, "sequence") == 0)
+        return DebugViewOutput::ImageSequence;
+    if (std::strcmp(name, "video") == 0)
+        return DebugViewOutput::Video;
+    if (std::strcmp(name, "discard") == 0)
+        return DebugViewOutput::Discard;
+    return DebugViewOutput::Auto;
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+int main(int argc, char **argv)
+{
+    DebugViewOptions options;
+    options.output = argc > 1 ? parseOutput(argv[1]) : DebugViewOutput::Auto;
+    options.output_dir = "debug_view_latency";
+    auto sink = DebugViewSink::create(options);
+
+    cv::Mat src(IMAGE_HEIGHT, IMAGE_WIDTH, CV_8UC3);
+    cv::randu(src, cv::Scalar::all(0), cv::Scalar::all(255));
+    const cv::Scalar lower(0, 80, 80), upper(30, 255, 255);
+    const cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+
+    auto run_block = [&](bool debug)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < FRAMES_PER_BLOCK; ++i)
+        {
+            cv::Mat hsv, binary, eroded;
+            cv::cvtColor(src, hsv, cv::COLOR_BGR2HSV);
+            cv::inRange(hsv, lower, upper, binary);
+            if (debug)
+            {
+                DrawBuffer overlay;
+                char text[96];
+                std::snprintf(text, sizeof(text), "Lower HSV: [%d, %d, %d]", 0, 80, 80);
+                overlay.addText(text, cv::Point2f(10, 30), 0.8, cv::Scalar(0, 0, 255), 2);
+                std::snprintf(text, sizeof(text), "Upper HSV: [%d, %d, %d]", 30, 255, 255);
+                overlay.addText(text, cv::Point2f(10, 60), 0.8, cv::Scalar(0, 0, 255), 2);
+                sink->push("HSV", hsv);
+                sink->push("Binary", binary, std::move(overlay));
+            }
+            cv::erode(binary, eroded, kernel, cv::Point(-1, -1), 3);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / FRAMES_PER_BLOCK;
+    };
+
+    // 预热
+    run_block(false);
+    run_block(true);
+
+    std::vector<double> off, on;
+    for (int b = 0; b < BLOCKS; ++b)
+    {
+        off.push_back(run_block(false));
+        on.push_back(run_block(true));
+    }
+    sink->stop();
+
+    const double off_us = median(off), on_us = median(on);
+    const double overhead = (on_us - off_us) / off_us;
+    std::printf("output %d : debug off %.1f us/frame, debug on %.1f us/frame, overhead %+.2f%%, dropped %llu\n",
+                static_cast<int>(sink->output()), off_us, on_us, overhead * 100.0,
+                static_cast<unsigned long long>(sink->dropped()));
+
+    const bool ok = overhead < MAX_OVERHEAD;
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/core/property_wrapper/property_wrapper.hpp"
+#include "vis_core/visual/img_proc/image_wrapper.hpp"
+#include "vis_core/visual/contour_proc/contour_wrapper.hpp"
+
+/**
+ * @brief 可能失败的查询接口在失败路径上的耗时对比
+ *
+ * - 改动前：getValue / getImg / create 经 VISCORE_THROW_ERROR 输出 stderr 并抛出异常，调用方捕获
+ *
+ * - 改动后：tryGetValue / tryGetImg / tryCreate 返回 Expected，调用方检查结果
+ *
+ * @note 抛出路径每次都会向 stderr 输出错误块，运行时建议将 stderr 重定向到 /dev/null
+ */
+
+constexpr int THROW_ITERATIONS = 2000;      //!< 抛出路径的迭代次数
+constexpr int EXPECTED_ITERATIONS = 200000; //!< Expected 路径的迭代次数
+
+template <typename Func>
+static double nsPerCall(int iterations, Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+static void report(const char *name, double throw_ns, double expected_ns)
+{
+    std::printf("%-16s throw %10.1f ns   expected %8.1f ns   x%.0f\n", name, throw_ns, expected_ns,
+                expected_ns > 0 ? throw_ns / expected_ns : 0.0);
+}
+
+int main()
+{
+    bool ok = true;
+    int misses = 0;
+
+    // ---------------- PropertyWrapper ----------------
+    PropertyWrapper<int> property;
+    double property_throw = nsPerCall(THROW_ITERATIONS, [&] {
+        try
+        {
+            misses += property.getValue();
+        }
+        catch (const std::runtime_error &)
+        {
+            ++misses;
+        }
+    });
+    double property_expected = nsPerCall(EXPECTED_ITERATIONS, [&] {
+        auto result = property.tryGetValue();
+        misses += result ? *result : 1;
+    });
+    ok &= !property.tryGetValue() && property.tryGetValue().error().code() == ErrorCode::NotSet;
+
+    // ---------------- ImageWrapper ----------------
+    auto image = ImageWrapper::create(cv::Mat(4, 4, CV_8UC1));
+    const ImageWrapper::ProcImgKey key = "binary";
+    double image_throw = nsPerCall(THROW_ITERATIONS, [&] {
+        try
+        {
+            misses += image->getImg(key).rows;
+        }
+        catch (const std::runtime_error &)
+        {
+            ++misses;
+        }
+    });
+    double image_expected = nsPerCall(EXPECTED_ITERATIONS, [&] {
+        auto result = image->tryGetImg(key);
+        misses += result ? result->rows : 1;
+    });
+    ok &= !image->tryGetImg(key) && image->tryGetImg(key).error().code() == ErrorCode::NotFound;
+
+    // ---------------- ContourWrapper ----------------
+    const std::vector<cv::Point> empty_points;
+    double contour_throw = nsPerCall(THROW_ITERATIONS, [&] {
+        try
+        {
+            misses += static_cast<int>(ContourWrapper<int>::create(empty_points)->points().size());
+        }
+        catch (const std::runtime_error &)
+        {
+            ++misses;
+        }
+    });
+    double contour_expected = nsPerCall(EXPECTED_ITERATIONS, [&] {
+        auto result = ContourWrapper<int>::tryCreate(empty_points);
+        misses += result ? static_cast<int>((*result)->points().size()) : 1;
+    });
+    ok &= !ContourWrapper<int>::tryCreate(empty_points) &&
+          ContourWrapper<int>::tryCreate(std::shared_ptr<const std::vector<cv::Point>>()).error().code() == ErrorCode::Empty &&
+          !ContourWrapper<int>::tryCreate(std::vector<cv::Point2f>()) &&
+          ContourWrapper<int>::tryCreate(std::vector<cv::Point2f>{{1.4f, 2.6f}}).has_value();
+
+    viscore_log::flush();
+    report("property", property_throw, property_expected);
+    report("image", image_throw, image_expected);
+    report("contour", contour_throw, contour_expected);
+    std::printf("misses %d\n", misses);
+
+    ok &= misses == 3 * (THROW_ITERATIONS + EXPECTED_ITERATIONS);
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
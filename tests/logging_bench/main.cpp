@@ -0,0 +1,182 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include "vis_core/core/logging/logging.h"
+
+/**
+ * @brief 日志调用线程开销与频率限制
+ *
+ * 1. 计时调用线程的开销：被频率限制丢弃的日志、被提交到后台线程的日志 (整数参数与字符串参数)，目标 < 50 ns / 条
+ * 2. 同一调用点的警告与其他等级一样受频率限制，下一个窗口输出被丢弃的数量
+ * 3. setRateLimitLevel 低于 Warning 时警告不受频率限制
+ *
+ * 开销仅输出，不作为失败条件；日志内容输出到临时文件中检查
+ */
+
+constexpr int SUPPRESSED_CALLS = 1'000'000; //!< 被丢弃日志的计时次数
+constexpr int BATCH = 200;                  //!< 每批提交的日志数量 (小于线程队列长度，避免因队列已满被丢弃)
+constexpr int BATCHES = 500;                //!< 提交日志的计时批数
+constexpr int WARNINGS = 100;               //!< 同一调用点连续输出的警告数量
+constexpr unsigned LIMIT = 5;               //!< 检查频率限制时每个调用点每秒的上限
+constexpr double TARGET_NS = 50;            //!< 目标开销 (ns / 条)
+
+/**
+ * @brief 将标准输出重定向到文件
+ */
+class StdoutCapture
+{
+    int __saved;
+
+public:
+    explicit StdoutCapture(const char *path)
+    {
+        std::fflush(stdout);
+        __saved = dup(STDOUT_FILENO);
+        const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        dup2(fd, STDOUT_FILENO);
+        close(fd);
+    }
+
+    ~StdoutCapture()
+    {
+        viscore_log::flush();
+        dup2(__saved, STDOUT_FILENO);
+        close(__saved);
+    }
+};
+
+static std::string readFile(const char *path)
+{
+    std::string content;
+    if (FILE *file = std::fopen(path, "r"))
+    {
+        char buffer[4096];
+        std::size_t length;
+        while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+            content.append(buffer, length);
+        std::fclose(file);
+    }
+    return content;
+}
+
+static int countOf(const std::string &text, const char *pattern)
+{
+    int count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+        ++count;
+    return count;
+}
+
+/**
+ * @brief 提交日志的开销：每批计时 BATCH 条，批间等待后台线程输出 (不计时)
+ */
+template <typename Func>
+static double submittedNsPerCall(Func &&func)
+{
+    double total = 0;
+    for (int b = 0; b < BATCHES; ++b)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BATCH; ++i)
+            func(i);
+        auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::nano>(end - start).count();
+        viscore_log::flush();
+    }
+    return total / (static_cast<double>(BATCHES) * BATCH);
+}
+
+static void report(const char *name, double ns)
+{
+    std::printf("%-26s %7.1f ns/call   %s\n", name, ns, ns < TARGET_NS ? "< 50 ns" : ">= 50 ns");
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    char path[] = "/tmp/viscore_logging_bench_XXXXXX";
+    const int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        std::printf("FAIL: 无法创建临时文件\n");
+        return 1;
+    }
+    close(fd);
+
+    // ---------------- 1. 调用线程开销 ----------------
+    double suppressed_ns = 0, int_ns = 0, string_ns = 0;
+    {
+        StdoutCapture capture(path);
+        viscore_log::setRateLimit(1);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < SUPPRESSED_CALLS; ++i)
+            VISCORE_NORMAL_INFO("suppressed %d\n", i);
+        auto end = std::chrono::steady_clock::now();
+        suppressed_ns = std::chrono::duration<double, std::nano>(end - start).count() / SUPPRESSED_CALLS;
+
+        viscore_log::setRateLimit(0);
+        const std::string name = "armor";
+        int_ns = submittedNsPerCall([](int i)
+                                    { VISCORE_NORMAL_INFO("submitted %d %.3f\n", i, 0.5 * i); });
+        string_ns = submittedNsPerCall([&name](int i)
+                                       { VISCORE_NORMAL_INFO("submitted %s %d\n", name.c_str(), i); });
+    }
+    report("suppressed", suppressed_ns);
+    report("submitted (int, double)", int_ns);
+    report("submitted (string, int)", string_ns);
+
+    // ---------------- 2. 警告受频率限制 ----------------
+    viscore_log::setRateLimit(LIMIT);
+    auto warnings = [](int count)
+    {
+        for (int i = 0; i < count; ++i)
+            VISCORE_WARNING_INFO("limited warning %d\n", i);
+    };
+    {
+        StdoutCapture capture(path);
+        warnings(WARNINGS);
+        // 进入下一个计数窗口，输出被丢弃的数量
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        warnings(1);
+    }
+    std::string output = readFile(path);
+    const int limited = countOf(output, "] limited warning");
+    std::printf("warnings  : %d calls   %d written (limit %u)\n", WARNINGS + 1, limited, LIMIT);
+    check(limited == static_cast<int>(LIMIT) + 1, "同一调用点的警告每秒不超过频率限制");
+    char summary[64];
+    std::snprintf(summary, sizeof(summary), "%d 条日志因频率限制被丢弃: limited warning", WARNINGS - static_cast<int>(LIMIT));
+    check(countOf(output, summary) == 1, "下一个窗口输出被丢弃的警告数量");
+
+    // ---------------- 3. 警告不受频率限制 ----------------
+    viscore_log::setRateLimitLevel(viscore_log::Level::Highlight);
+    {
+        StdoutCapture capture(path);
+        for (int i = 0; i < WARNINGS; ++i)
+            VISCORE_WARNING_INFO("unlimited warning %d\n", i);
+        for (int i = 0; i < WARNINGS; ++i)
+            VISCORE_NORMAL_INFO("limited info %d\n", i);
+    }
+    output = readFile(path);
+    check(countOf(output, "] unlimited warning") == WARNINGS, "setRateLimitLevel 低于 Warning 时警告不受频率限制");
+    check(countOf(output, "] limited info") == static_cast<int>(LIMIT), "setRateLimitLevel 以下的等级仍受频率限制");
+
+    std::remove(path);
+    if (failures == 0)
+        std::printf("PASS\n");
+    return failures == 0 ? 0 : 1;
+}
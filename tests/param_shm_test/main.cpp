@@ -0,0 +1,161 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "vis_core/utils/param_manager/param_manager.h"
+#include "vis_core/utils/param_manager/param_shm.h"
+
+/**
+ * @brief 跨进程共享参数块的正确性测试
+ *
+ * 1. 两个映射 (同一进程内、以及 fork 出的子进程) 之间的创建、发布、读取与 sync
+ * 2. 字段表不一致的参数结构体无法打开同一参数块
+ * 3. 并发发布与读取时读取者不会看到部分写入的数据
+ * 4. 顺序锁被已退出的进程持有时接管；被仍存活的进程持有时不接管，发布超时返回 0
+ */
+
+struct ShmTestParams
+{
+    double gain = 1.0;
+    int count = 1;
+    int check = 1; //!< 恒为 count 的两倍加一，用于检测部分写入
+
+    PARAM_MANAGER_INIT(ShmTestParams,
+                       PARAM_MANAGER_ADD_PARAM(gain);
+                       PARAM_MANAGER_ADD_PARAM(count);
+                       PARAM_MANAGER_ADD_PARAM(check););
+};
+
+struct ShmOtherParams
+{
+    double gain = 1.0;
+
+    PARAM_MANAGER_INIT(ShmOtherParams,
+                       PARAM_MANAGER_ADD_PARAM(gain););
+};
+
+/**
+ * @brief 填充第 i 组参数 (参数结构体默认构造时会读取 yml，循环中复用同一对象)
+ */
+static const ShmTestParams &fill(ShmTestParams &params, int i)
+{
+    params.gain = 0.5 * i;
+    params.count = i;
+    params.check = 2 * i + 1;
+    return params;
+}
+
+static bool consistent(const ShmTestParams &params)
+{
+    return params.check == 2 * params.count + 1 && params.gain == 0.5 * params.count;
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    const std::string name = "viscore_param_shm_test_" + std::to_string(getpid());
+    ParamSharedBlock<ShmTestParams>::remove(name);
+
+    // ---------------- 1. 两个映射之间的发布、读取与同步 ----------------
+    ShmTestParams published;
+    auto writer = ParamSharedBlock<ShmTestParams>::create(name, fill(published, 1));
+    auto reader = ParamSharedBlock<ShmTestParams>::create(name);
+    check(writer && reader, "创建并再次打开共享参数块");
+    if (!writer || !reader)
+        return 1;
+
+    ShmTestParams read_back;
+    check(reader->read(read_back) && read_back.count == 1 && consistent(read_back), "读取创建者写入的初始参数");
+
+    auto snapshot = ParamSnapshot<ShmTestParams>::create();
+    check(reader->sync(*snapshot) && snapshot->load()->count == 1, "首次 sync 总是同步");
+    check(!reader->sync(*snapshot), "版本未变化时 sync 不发布新快照");
+
+    const std::uint64_t version = writer->publish(fill(published, 2));
+    check(version == 1 && reader->version() == version, "发布后两个映射的版本号一致");
+    check(reader->sync(*snapshot) && snapshot->load()->count == 2 && consistent(*snapshot->load()), "发布后 sync 更新快照");
+
+    // 子进程通过独立的映射发布，父进程读取
+    const pid_t child = fork();
+    if (child == 0)
+    {
+        auto block = ParamSharedBlock<ShmTestParams>::create(name);
+        _exit(block && block->publish(fill(published, 3)) != 0 ? 0 : 1);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    check(WIFEXITED(status) && WEXITSTATUS(status) == 0, "子进程打开并发布");
+    check(reader->sync(*snapshot) && snapshot->load()->count == 3 && consistent(*snapshot->load()), "读取子进程发布的参数");
+
+    // ---------------- 2. 字段表不一致 ----------------
+    check(!ParamSharedBlock<ShmOtherParams>::create(name), "字段表不一致时打开失败");
+
+    // ---------------- 3. 并发发布与读取 ----------------
+    std::atomic<bool> done{false};
+    std::thread publisher([&]
+                          {
+        ShmTestParams params = published;
+        for (int i = 4; i < 20000; ++i)
+            writer->publish(fill(params, i));
+        done = true; });
+    int reads = 0, torn = 0;
+    ShmTestParams params = published;
+    while (!done)
+    {
+        if (reader->read(params))
+        {
+            ++reads;
+            torn += !consistent(params);
+        }
+    }
+    publisher.join();
+    std::printf("concurrent : %d reads, %d torn\n", reads, torn);
+    check(torn == 0, "并发读取不会看到部分写入的数据");
+
+    // ---------------- 4. 写入进程失效 ----------------
+    auto raw = SharedMemorySegment::open(name, sizeof(ParamShmHeader) + ShmTestParams().schema().fixed_size);
+    auto *header = static_cast<ParamShmHeader *>(raw->data());
+
+    // 已退出的进程持有顺序锁：接管
+    const pid_t dead = fork();
+    if (dead == 0)
+        _exit(0);
+    waitpid(dead, nullptr, 0);
+    header->sequence.fetch_add(1);
+    header->writer_pid.store(dead);
+    check(!reader->read(read_back), "顺序锁被持有时读取失败");
+    check(writer->publish(fill(published, 7)) != 0, "顺序锁被已退出的进程持有时接管并发布");
+    check((header->sequence.load() & 1) == 0 && header->writer_pid.load() == 0, "接管后释放顺序锁");
+    check(reader->read(read_back) && read_back.count == 7 && consistent(read_back), "接管后读取到新参数");
+
+    // 仍存活的进程持有顺序锁：不接管
+    header->sequence.fetch_add(1);
+    header->writer_pid.store(getpid());
+    const auto start = std::chrono::steady_clock::now();
+    check(writer->publish(fill(published, 8)) == 0, "顺序锁被存活的进程持有时不接管");
+    const double waited = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::printf("live holder: publish gave up after %.0f ms\n", waited);
+    check(reader->read(read_back) == false, "存活的写入进程持有顺序锁时读取失败");
+    header->writer_pid.store(0);
+    header->sequence.fetch_add(1);
+    check(reader->read(read_back) && read_back.count == 7, "存活的写入进程释放后数据未被覆盖");
+
+    ParamSharedBlock<ShmTestParams>::remove(name);
+    if (failures == 0)
+        std::printf("PASS\n");
+    return failures == 0 ? 0 : 1;
+}
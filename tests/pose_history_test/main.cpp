@@ -0,0 +1,167 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/math/pose_proc/pose_history.hpp"
+
+/**
+ * @brief PoseHistory 的插值与单写者多读者测试
+ *
+ * 1. 容量 2、4、8 的缓冲区写满数轮后，最旧与最新样本之间的任意时刻 (含相邻样本的中点) 均可插值，
+ *    结果与解析轨迹一致；超出范围的查询返回 NotFound
+ * 2. 1 个写线程连续写入，多个读线程同时调用 latest / sample：读到的位姿与时间戳一致，不出现撕裂读取
+ * 3. 时间戳不递增的样本被丢弃
+ *
+ * @note 建议同时以 -fsanitize=thread 编译运行，检查多读者测试中不存在数据竞争
+ *
+ *       样本 n 的时间戳为 1000 (n + 1) ns，位姿为绕 z 轴旋转 ANGLE_STEP * n、平移 (n, 2n, 0)，
+ *       相邻样本之间的插值结果可由时间戳解析计算
+ */
+
+constexpr double ANGLE_STEP = 1e-6;         //!< 相邻样本的旋转角增量 (rad)
+constexpr std::int64_t STAMP_STEP = 1000;   //!< 相邻样本的时间间隔 (ns)
+constexpr int READER_COUNT = 4;             //!< 读线程数量
+constexpr auto WRITE_DURATION = std::chrono::milliseconds(300); //!< 多读者测试中写线程的持续时间
+constexpr double ANGLE_TOLERANCE = 1e-9;    //!< 允许的旋转角误差 (rad)
+constexpr double TRANSLATION_TOLERANCE = 1e-6; //!< 允许的平移误差
+
+static std::int64_t stampOf(int n) { return STAMP_STEP * (n + 1); }
+
+static Transform6D poseOf(double n) { return Transform6D(cv::Vec3d(0, 0, ANGLE_STEP * n), cv::Vec3d(n, 2 * n, 0)); }
+
+/**
+ * @brief 位姿是否与时间戳 stamp 处的解析轨迹一致
+ */
+static bool matches(const Transform6D &pose, std::int64_t stamp)
+{
+    const double n = static_cast<double>(stamp) / STAMP_STEP - 1;
+    const cv::Vec3d rvec = pose.rvec(), tvec = pose.tvec();
+    return std::abs(rvec(0)) < ANGLE_TOLERANCE && std::abs(rvec(1)) < ANGLE_TOLERANCE &&
+           std::abs(rvec(2) - ANGLE_STEP * n) < ANGLE_TOLERANCE &&
+           std::abs(tvec(0) - n) < TRANSLATION_TOLERANCE && std::abs(tvec(1) - 2 * n) < TRANSLATION_TOLERANCE &&
+           std::abs(tvec(2)) < TRANSLATION_TOLERANCE;
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    // ---------------- 1. 环形缓冲区回绕前后的插值 ----------------
+    check(PoseHistory(0).capacity() == 2 && PoseHistory(1).capacity() == 2 && PoseHistory(5).capacity() == 8,
+          "容量向上取整为 2 的幂，至少为 2");
+    for (std::size_t capacity : {2, 4, 8})
+    {
+        PoseHistory history(capacity);
+        check(history.latest().error().code() == ErrorCode::Empty && history.sample(0).error().code() == ErrorCode::Empty,
+              "空缓冲区的查询返回 Empty");
+
+        int mismatch = 0, missing = 0, out_of_range = 0;
+        const int count = static_cast<int>(3 * capacity + 1);
+        for (int n = 0; n < count; ++n)
+        {
+            history.push(stampOf(n), poseOf(n));
+            const int oldest = n + 1 > static_cast<int>(capacity) ? n + 1 - static_cast<int>(capacity) : 0;
+            // 最旧到最新样本之间的每个样本时刻与相邻样本的中点
+            for (std::int64_t stamp = stampOf(oldest); stamp <= stampOf(n); stamp += STAMP_STEP / 2)
+            {
+                auto pose = history.sample(stamp);
+                if (!pose)
+                    ++missing;
+                else if (!matches(*pose, stamp))
+                    ++mismatch;
+            }
+            // 超出范围的查询
+            out_of_range += history.sample(stampOf(oldest) - 1).error().code() != ErrorCode::NotFound;
+            out_of_range += history.sample(stampOf(n) + 1).error().code() != ErrorCode::NotFound;
+
+            auto latest = history.latest();
+            mismatch += !latest || latest->stamp != stampOf(n) || !matches(latest->transform, stampOf(n));
+        }
+        std::printf("capacity %zu : size %zu  missing %d  mismatch %d  out of range %d\n", capacity, history.size(),
+                    missing, mismatch, out_of_range);
+        check(history.size() == capacity, "写满后保存的样本数量等于容量");
+        check(missing == 0, "最旧与最新样本之间的查询均成功");
+        check(mismatch == 0, "插值结果与解析轨迹一致");
+        check(out_of_range == 0, "超出范围的查询返回 NotFound");
+    }
+
+    // ---------------- 2. 单写者多读者 ----------------
+    for (std::size_t capacity : {2, 64})
+    {
+        PoseHistory history(capacity);
+        std::atomic<bool> done{false};
+        std::atomic<int> ready{0}, mismatch{0};
+        std::atomic<long long> hits{0}, misses{0};
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < READER_COUNT; ++r)
+            readers.emplace_back([&, r]
+                                 {
+                std::mt19937 rng(45 + r);
+                std::uniform_int_distribution<std::int64_t> offset(0, STAMP_STEP * static_cast<std::int64_t>(capacity));
+                long long local_hits = 0, local_misses = 0;
+                ready.fetch_add(1, std::memory_order_release);
+                while (!done.load(std::memory_order_acquire))
+                {
+                    auto latest = history.latest();
+                    if (!latest)
+                        continue;
+                    if (!matches(latest->transform, latest->stamp))
+                        mismatch.fetch_add(1, std::memory_order_relaxed);
+
+                    const std::int64_t stamp = latest->stamp - offset(rng);
+                    auto pose = history.sample(stamp);
+                    if (!pose)
+                        ++local_misses;
+                    else if (!matches(*pose, stamp))
+                        mismatch.fetch_add(1, std::memory_order_relaxed);
+                    else
+                        ++local_hits;
+                }
+                hits.fetch_add(local_hits);
+                misses.fetch_add(local_misses); });
+
+        while (ready.load(std::memory_order_acquire) < READER_COUNT)
+            std::this_thread::yield();
+        int writes = 0;
+        const auto deadline = std::chrono::steady_clock::now() + WRITE_DURATION;
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            history.push(stampOf(writes), poseOf(writes));
+            ++writes;
+        }
+        done.store(true, std::memory_order_release);
+        for (auto &reader : readers)
+            reader.join();
+
+        std::printf("capacity %zu : %d writes  %d readers  hits %lld  misses %lld  mismatch %d\n", capacity, writes, READER_COUNT,
+                    hits.load(), misses.load(), mismatch.load());
+        check(mismatch.load() == 0, "并发读取的位姿与时间戳一致");
+        check(hits.load() > 0, "并发读取时查询可以成功");
+    }
+
+    // ---------------- 3. 时间戳不递增 ----------------
+    PoseHistory history(4);
+    history.push(stampOf(0), poseOf(0));
+    check(!history.push(stampOf(0), poseOf(1)), "时间戳不递增的样本被丢弃");
+    check(history.size() == 1 && matches(history.latest()->transform, stampOf(0)), "丢弃样本后缓冲区不变");
+
+    if (failures == 0)
+        std::printf("PASS\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/math/pose_proc/pose_node.h"
+
+/**
+ * @brief 坐标系树的正确性测试
+ *
+ * 1. 5 层坐标系链的缓存世界变换与逐级 operator+ 重新计算的结果一致，修改中间层后缓存随之更新
+ * 2. 修改某一分支不影响其他分支的缓存
+ * 3. 改变父坐标系 (reparent) 后子树的世界变换与父子关系正确，且不能形成环
+ * 4. 删除坐标系时一并删除其子孙，已移出的子树不受影响
+ */
+
+constexpr double TOLERANCE = 1e-9; //!< 变换比较的允许误差
+constexpr int BENCH_ROUNDS = 100000; //!< 缓存与重新计算的耗时对比次数
+
+static std::mt19937 rng(44);
+
+static Transform6D randomTransform()
+{
+    std::uniform_real_distribution<double> angle(-1.0, 1.0), offset(-2.0, 2.0);
+    return Transform6D(cv::Vec3d(angle(rng), angle(rng), angle(rng)), cv::Vec3d(offset(rng), offset(rng), offset(rng)));
+}
+
+static bool near(const Transform6D &a, const Transform6D &b)
+{
+    for (int i = 0; i < 9; ++i)
+        if (!(std::abs(a.rmat().val[i] - b.rmat().val[i]) < TOLERANCE))
+            return false;
+    for (int i = 0; i < 3; ++i)
+        if (!(std::abs(a.tvec()(i) - b.tvec()(i)) < TOLERANCE))
+            return false;
+    return true;
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    const FrameId world = FrameId::intern("pose_tree_test/world");
+    const FrameId chain[4] = {FrameId::intern("pose_tree_test/l1"), FrameId::intern("pose_tree_test/l2"),
+                              FrameId::intern("pose_tree_test/l3"), FrameId::intern("pose_tree_test/l4")};
+    const FrameId branch = FrameId::intern("pose_tree_test/branch");
+    const FrameId leaf = FrameId::intern("pose_tree_test/leaf");
+
+    PoseTree tree;
+    Transform6D local[5] = {randomTransform(), randomTransform(), randomTransform(), randomTransform(), randomTransform()};
+    tree.setFrame(world, FrameId(), local[0]);
+    FrameId parent = world;
+    for (int i = 0; i < 4; ++i)
+    {
+        tree.setFrame(chain[i], parent, local[i + 1]);
+        parent = chain[i];
+    }
+    const Transform6D branch_local = randomTransform();
+    tree.setFrame(branch, world, branch_local);
+    tree.setFrame(leaf, branch, randomTransform());
+    check(tree.size() == 7, "size after construction");
+
+    auto recompute = [&local]()
+    {
+        Transform6D result = local[0];
+        for (int i = 1; i < 5; ++i)
+            result = result + local[i];
+        return result;
+    };
+
+    // ---------------- 5 层链：缓存与重新计算 ----------------
+    check(near(tree.worldTransform(chain[3]), recompute()), "cached 5-level chain != recomputed");
+    check(near(tree.worldTransform(chain[3]), recompute()), "second cached query != recomputed");
+    const Transform6D branch_world_before = tree.worldTransform(leaf);
+
+    local[2] = randomTransform();
+    tree.setTransform(chain[1], local[2]);
+    check(near(tree.worldTransform(chain[3]), recompute()), "chain after setTransform != recomputed");
+    check(near(tree.worldTransform(leaf), branch_world_before), "unrelated branch changed after setTransform");
+
+    // transform(from, to) 与世界变换的关系
+    const Transform6D l1_to_l4 = tree.transform(chain[0], chain[3]);
+    check(near(tree.worldTransform(chain[0]) + l1_to_l4, tree.worldTransform(chain[3])), "transform(l1, l4)");
+    check(near(tree.transform(chain[2], chain[3]), local[4]), "transform(parent, child) != local");
+    check(near(tree.worldTransform(leaf) + tree.transform(leaf, chain[3]), tree.worldTransform(chain[3])), "transform across branches");
+
+    // ---------------- reparent ----------------
+    // 将 l3 (及其子坐标系 l4) 移到 branch 下
+    const Transform6D moved_local = randomTransform();
+    tree.setFrame(chain[2], branch, moved_local);
+    check(tree.parent(chain[2]) == branch, "parent after reparent");
+    check(tree.size() == 7, "size after reparent");
+    check(near(tree.worldTransform(chain[3]), tree.worldTransform(branch) + moved_local + local[4]), "world after reparent");
+
+    bool threw = false;
+    try
+    {
+        tree.setFrame(branch, chain[3], randomTransform()); // branch 不能以其子孙为父坐标系
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    check(threw, "reparent into own subtree must throw");
+    check(tree.parent(branch) == world, "failed reparent must leave the tree unchanged");
+
+    // ---------------- 删除 ----------------
+    // l2 已不再是 l3 的父坐标系，删除 l1 只应删除 l1 与 l2
+    tree.removeFrame(chain[0]);
+    check(!tree.contains(chain[0]) && !tree.contains(chain[1]), "removed subtree still present");
+    check(tree.contains(chain[2]) && tree.contains(chain[3]), "reparented subtree removed with old parent");
+    check(tree.size() == 5, "size after removing l1");
+    check(!tree.tryWorldTransform(chain[1]) && tree.tryWorldTransform(chain[1]).error().code() == ErrorCode::NotFound,
+          "tryWorldTransform on removed frame");
+    check(!tree.tryTransform(chain[0], chain[3]), "tryTransform from removed frame");
+
+    tree.removeFrame(branch);
+    check(tree.size() == 1 && tree.contains(world), "size after removing branch");
+    check(!tree.contains(leaf) && !tree.contains(chain[2]) && !tree.contains(chain[3]), "branch descendants removed");
+
+    // 重新添加已删除的坐标系
+    tree.setFrame(chain[0], world, local[1]);
+    check(tree.size() == 2 && near(tree.worldTransform(chain[0]), local[0] + local[1]), "re-added frame");
+
+    // ---------------- 缓存与重新计算的耗时 ----------------
+    PoseTree bench_tree;
+    bench_tree.setFrame(world, FrameId(), local[0]);
+    parent = world;
+    for (int i = 0; i < 4; ++i)
+    {
+        bench_tree.setFrame(chain[i], parent, local[i + 1]);
+        parent = chain[i];
+    }
+    double sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; ++r)
+        sink += bench_tree.worldTransform(chain[3]).tvec()(0);
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; ++r)
+        sink += recompute().tvec()(0);
+    auto end = std::chrono::steady_clock::now();
+    std::printf("5-level chain: cached %.1f ns, recomputed %.1f ns (checksum %.3f)\n",
+                std::chrono::duration<double, std::nano>(mid - start).count() / BENCH_ROUNDS,
+                std::chrono::duration<double, std::nano>(end - mid).count() / BENCH_ROUNDS, sink);
+
+    std::printf("%s (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core.hpp>
+
+#include "vis_core/utils/pose_solver/quad_pose_solver.h"
+
+/**
+ * @brief QuadPoseSolver 批量解算的吞吐量
+ *
+ * 1. 以随机位姿将四边形模型投影到带畸变的相机上，得到无噪声的角点
+ * 2. 分别以 RefineIterations = 0、1、2 批量解算，统计每秒解算的四边形数量
+ * 3. 以 cv::solvePnP (SOLVEPNP_IPPE) 作为参照
+ * 4. 以扰动后的真值模拟上一帧位姿，比较单个特征热启动 refine 与完整解算 solve 的耗时 (目标加速 3 ~ 5 倍)
+ *
+ * 同时校验解算结果与真值一致，不一致时返回非零；吞吐量与加速比仅输出，不作为失败条件
+ */
+
+constexpr int COUNT = 4096;                 //!< 四边形数量
+constexpr int ROUNDS = 20;                  //!< 重复次数
+constexpr double TARGET = 1e6;              //!< 目标吞吐量 (四边形 / 秒)
+constexpr double RMS_TOLERANCE = 0.05;      //!< 允许的重投影误差均方根 (像素)
+constexpr double TRANSLATION_TOLERANCE = 1e-3; //!< 允许的平移误差 (相对距离)
+constexpr double WARM_TRANSLATION_TOLERANCE = 5e-3; //!< 热启动允许的平移误差 (相对距离，热启动在残差低于像素噪声时提前停止)
+constexpr double FRAME_ROTATION = 0.01;     //!< 上一帧位姿相对真值的旋转扰动 (rad)
+constexpr double FRAME_TRANSLATION = 0.005; //!< 上一帧位姿相对真值的平移扰动
+constexpr double SPEEDUP_TARGET = 3;        //!< 热启动相对完整解算的目标加速比
+
+template <typename Func>
+static double quadsPerSecond(Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        func();
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(ROUNDS) * COUNT / std::chrono::duration<double>(end - start).count();
+}
+
+template <typename Func>
+static double nsPerFeature(Func &&func)
+{
+    return 1e9 / quadsPerSecond(std::forward<Func>(func));
+}
+
+static void report(const char *name, double rate)
+{
+    std::printf("%-22s %10.0f quads/s   %6.1f ns/quad   %s\n", name, rate, 1e9 / rate, rate >= TARGET ? ">= 1M/s" : "< 1M/s");
+}
+
+int main()
+{
+    const cv::Matx33f K(1000, 0, 640,
+                        0, 1000, 512,
+                        0, 0, 1);
+    const cv::Matx51f D(-0.08f, 0.05f, 0.001f, -0.0005f, 0.0f);
+    auto camera = CameraWrapper::create(K, D, cv::Size(1280, 1024));
+    auto solver = QuadPoseSolver::create(camera, 0.135, 0.055);
+
+    // ---------------- 合成数据 ----------------
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> angle(-0.5, 0.5), lateral(-0.4, 0.4), depth(1.0, 5.0);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::vector<Transform6D> truth(COUNT), previous(COUNT);
+    std::vector<QuadPoseSolver::Corners> corners(COUNT);
+    const auto &model = solver->modelPoints();
+    for (int i = 0; i < COUNT; ++i)
+    {
+        const cv::Vec3d rvec(angle(rng), angle(rng), angle(rng)), tvec(lateral(rng), lateral(rng), depth(rng));
+        truth[i] = Transform6D(rvec, tvec);
+        previous[i] = Transform6D(rvec + FRAME_ROTATION * cv::Vec3d(unit(rng), unit(rng), unit(rng)),
+                                  tvec + FRAME_TRANSLATION * cv::Vec3d(unit(rng), unit(rng), unit(rng)));
+        cv::Point2d pixels[4];
+        camera->project(std::span<const cv::Point3d>(model.data(), 4), truth[i], std::span<cv::Point2d>(pixels, 4));
+        for (int k = 0; k < 4; ++k)
+            corners[i][k] = cv::Point2f(static_cast<float>(pixels[k].x), static_cast<float>(pixels[k].y));
+    }
+
+    bool ok = true;
+    double sink = 0;
+    std::vector<QuadPoseSolver::Result> results(COUNT);
+
+    // ---------------- QuadPoseSolver ----------------
+    const int default_iterations = solver->getRefineIterations();
+    for (int iterations : {0, 1, 2})
+    {
+        solver->setRefineIterations(iterations);
+        const double rate = quadsPerSecond([&] {
+            solver->solve(std::span<const QuadPoseSolver::Corners>(corners), std::span<QuadPoseSolver::Result>(results));
+            sink += results[0].rms_error;
+        });
+        double max_rms = 0, max_translation = 0;
+        for (int i = 0; i < COUNT; ++i)
+        {
+            if (!results[i].valid)
+            {
+                ok = false;
+                continue;
+            }
+            max_rms = std::max(max_rms, results[i].rms_error);
+            const cv::Vec3d diff = results[i].camera_to_feature.tvec() - truth[i].tvec();
+            max_translation = std::max(max_translation, std::sqrt(diff.dot(diff) / truth[i].tvec().dot(truth[i].tvec())));
+        }
+        ok &= max_rms < RMS_TOLERANCE && max_translation < TRANSLATION_TOLERANCE;
+        char name[32];
+        std::snprintf(name, sizeof(name), "solver (refine %d)", iterations);
+        report(name, rate);
+        std::printf("%-22s max rms %.4f px   max translation error %.2e\n", "", max_rms, max_translation);
+    }
+
+    // ---------------- cv::solvePnP 参照 ----------------
+    std::vector<cv::Point3f> object(4);
+    for (int k = 0; k < 4; ++k)
+        object[k] = cv::Point3f(static_cast<float>(model[k].x), static_cast<float>(model[k].y), 0.f);
+    const double pnp_rate = quadsPerSecond([&] {
+        std::vector<cv::Point2f> image(4);
+        cv::Vec3d rvec, tvec;
+        for (int i = 0; i < COUNT; ++i)
+        {
+            std::copy(corners[i].begin(), corners[i].end(), image.begin());
+            cv::solvePnP(object, image, cv::Mat(K), cv::Mat(D), rvec, tvec, false, cv::SOLVEPNP_IPPE);
+            sink += tvec(2);
+        }
+    });
+    report("cv::solvePnP (IPPE)", pnp_rate);
+
+    // ---------------- 热启动 refine 与完整解算 solve ----------------
+    solver->setRefineIterations(default_iterations);
+    const double solve_ns = nsPerFeature([&] {
+        for (int i = 0; i < COUNT; ++i)
+            results[i] = solver->solve(corners[i]);
+        sink += results[0].rms_error;
+    });
+    const double refine_ns = nsPerFeature([&] {
+        for (int i = 0; i < COUNT; ++i)
+            results[i] = solver->refine(corners[i], previous[i]);
+        sink += results[0].rms_error;
+    });
+    double max_rms = 0, max_translation = 0, iterations = 0;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        if (!results[i].valid)
+        {
+            ok = false;
+            continue;
+        }
+        max_rms = std::max(max_rms, results[i].rms_error);
+        iterations += results[i].iterations;
+        const cv::Vec3d diff = results[i].camera_to_feature.tvec() - truth[i].tvec();
+        max_translation = std::max(max_translation, std::sqrt(diff.dot(diff) / truth[i].tvec().dot(truth[i].tvec())));
+    }
+    ok &= max_rms <= solver->getWarmMaxError() && max_translation < WARM_TRANSLATION_TOLERANCE;
+    const double speedup = refine_ns > 0 ? solve_ns / refine_ns : 0;
+    std::printf("%-22s %6.1f ns/feature\n", "solve (single)", solve_ns);
+    std::printf("%-22s %6.1f ns/feature   x%.2f   %s\n", "refine (warm start)", refine_ns, speedup,
+                speedup >= SPEEDUP_TARGET ? ">= 3x" : "< 3x");
+    std::printf("%-22s max rms %.4f px   max translation error %.2e   mean iterations %.2f\n", "", max_rms,
+                max_translation, iterations / COUNT);
+
+    std::printf("(sink %.3f)\n", sink);
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/utils/pose_solver/quad_pose_solver.h"
+
+/**
+ * @brief QuadPoseSolver 热启动的正确性测试
+ *
+ * 1. 四边形沿平滑轨迹运动，逐帧批量解算特征：热启动命中率高，迭代次数不超过 WarmIterations，位姿与真值一致
+ * 2. WarmMaxError 取极小值时热启动全部失败：回退到完整解算，命中数不变，位姿仍与真值一致
+ * 3. 位姿发生跳变时无论是否命中，位姿均与真值一致，且命中数与回退次数之和等于热启动尝试次数
+ * 4. 关闭 WarmStart 时只执行完整解算
+ *
+ * @note 小尺寸四边形的离面旋转对角点位置不敏感，热启动在误差远小于像素噪声时即停止迭代，
+ *       因此以模型角点在两位姿下的投影之差衡量旋转，而不直接比较旋转角
+ */
+
+constexpr int FEATURES = 3;                      //!< 同时跟踪的特征数量
+constexpr int FRAMES = 200;                      //!< 平滑轨迹的帧数
+constexpr double MIN_HIT_RATE = 0.95;            //!< 平滑轨迹上的最低热启动命中率
+constexpr double TRANSLATION_TOLERANCE = 2e-3;   //!< 允许的平移误差 (相对距离)
+constexpr double REPROJECTION_TOLERANCE = 0.05;  //!< 解算位姿与真值位姿投影角点之差的允许均方根 (像素)
+
+/**
+ * @brief 第 frame 帧第 index 个特征的真值位姿 camera_to_feature
+ */
+static Transform6D trackPose(int frame, int index, double jump = 0)
+{
+    const double s = 0.02 * frame + index;
+    const cv::Vec3d rvec(0.3 * std::sin(s) + jump, 0.2 * std::cos(0.7 * s), 0.1 * std::sin(1.3 * s));
+    const cv::Vec3d tvec(0.3 * std::sin(0.5 * s) + 0.2 * (index - 1) + jump, 0.1 * std::cos(s), 2.0 + 0.5 * std::sin(0.3 * s));
+    return Transform6D(rvec, tvec);
+}
+
+static bool near(const CameraWrapper &camera, const std::array<cv::Point3d, 4> &model,
+                 const Transform6D &result, const Transform6D &truth)
+{
+    const cv::Vec3d diff = result.tvec() - truth.tvec();
+    if (!(std::sqrt(diff.dot(diff) / truth.tvec().dot(truth.tvec())) < TRANSLATION_TOLERANCE))
+        return false;
+    cv::Point2d solved[4], expected[4];
+    camera.project(std::span<const cv::Point3d>(model.data(), 4), result, std::span<cv::Point2d>(solved, 4));
+    camera.project(std::span<const cv::Point3d>(model.data(), 4), truth, std::span<cv::Point2d>(expected, 4));
+    double error = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+        const cv::Point2d d = solved[k] - expected[k];
+        error += d.x * d.x + d.y * d.y;
+    }
+    return std::sqrt(error / 4) < REPROJECTION_TOLERANCE;
+}
+
+int main()
+{
+    int failures = 0;
+    auto check = [&failures](bool cond, const char *what)
+    {
+        if (!cond)
+        {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    const cv::Matx33f K(1000, 0, 640,
+                        0, 1000, 512,
+                        0, 0, 1);
+    const cv::Matx51f D(-0.08f, 0.05f, 0.001f, -0.0005f, 0.0f);
+    auto camera = CameraWrapper::create(K, D, cv::Size(1280, 1024));
+    auto solver = QuadPoseSolver::create(camera, 0.135, 0.055);
+    const FrameId camera_frame = solver->getCameraFrame();
+    const auto &model = solver->modelPoints();
+
+    std::vector<QuadrilateralBase_ptr> features(FEATURES);
+    for (auto &feature : features)
+        feature = QuadrilateralBase::create(std::vector<cv::Point2f>(4));
+
+    // 将各特征的角点更新为第 frame 帧的投影，返回真值位姿
+    auto observe = [&](int frame, double jump)
+    {
+        std::vector<Transform6D> truth(FEATURES);
+        for (int i = 0; i < FEATURES; ++i)
+        {
+            truth[i] = trackPose(frame, i, jump);
+            cv::Point2d pixels[4];
+            camera->project(std::span<const cv::Point3d>(model.data(), 4), truth[i], std::span<cv::Point2d>(pixels, 4));
+            std::vector<cv::Point2f> corners(4);
+            for (int k = 0; k < 4; ++k)
+                corners[k] = cv::Point2f(static_cast<float>(pixels[k].x), static_cast<float>(pixels[k].y));
+            features[i]->getImageCache().setCorners(corners);
+        }
+        return truth;
+    };
+    // 解算并校验所有特征的位姿
+    auto solveAndCheck = [&](const std::vector<Transform6D> &truth)
+    {
+        bool ok = solver->solve(std::span<const QuadrilateralBase_ptr>(features)) == FEATURES;
+        for (int i = 0; i < FEATURES; ++i)
+        {
+            auto pose = features[i]->getPoseCache().poseIn(camera_frame, PoseTree());
+            ok &= pose && near(*camera, model, *pose, truth[i]);
+        }
+        return ok;
+    };
+
+    // ---------------- 1. 平滑轨迹 ----------------
+    bool track_ok = true;
+    for (int frame = 0; frame < FRAMES; ++frame)
+        track_ok &= solveAndCheck(observe(frame, 0));
+    check(track_ok, "平滑轨迹上的位姿与真值一致");
+
+    QuadPoseSolver::Statistics stats = solver->statistics();
+    std::printf("track     : attempts %llu  hits %llu  hit rate %.3f  mean iterations %.2f  full solves %llu\n",
+                static_cast<unsigned long long>(stats.warm_attempts), static_cast<unsigned long long>(stats.warm_hits),
+                stats.hitRate(), stats.meanIterations(), static_cast<unsigned long long>(stats.full_solves));
+    check(stats.warm_attempts == static_cast<std::uint64_t>(FRAMES - 1) * FEATURES, "首帧之后每帧每个特征尝试一次热启动");
+    check(stats.hitRate() >= MIN_HIT_RATE, "平滑轨迹上的热启动命中率");
+    check(stats.meanIterations() <= solver->getWarmIterations(), "热启动迭代次数不超过 WarmIterations");
+    check(stats.full_solves == FEATURES + (stats.warm_attempts - stats.warm_hits), "完整解算仅发生在首帧与热启动失败时");
+
+    // ---------------- 2. 残差超过 WarmMaxError 时回退 ----------------
+    const double max_error = solver->getWarmMaxError();
+    solver->setWarmMaxError(1e-9);
+    solver->resetStatistics();
+    bool fallback_ok = true;
+    for (int frame = FRAMES; frame < FRAMES + 10; ++frame)
+        fallback_ok &= solveAndCheck(observe(frame, 0));
+    check(fallback_ok, "回退到完整解算后的位姿与真值一致");
+
+    stats = solver->statistics();
+    std::printf("fallback  : attempts %llu  hits %llu  full solves %llu\n", static_cast<unsigned long long>(stats.warm_attempts),
+                static_cast<unsigned long long>(stats.warm_hits), static_cast<unsigned long long>(stats.full_solves));
+    check(stats.warm_attempts == 10 * FEATURES, "每帧每个特征仍尝试一次热启动");
+    check(stats.warm_hits == 0, "残差超过 WarmMaxError 的热启动不计为命中");
+    check(stats.full_solves == 10 * FEATURES, "每次热启动失败都回退到完整解算");
+    solver->setWarmMaxError(max_error);
+
+    // ---------------- 3. 位姿跳变 ----------------
+    solver->resetStatistics();
+    check(solveAndCheck(observe(FRAMES + 10, 0.8)), "位姿跳变后的位姿与真值一致");
+    stats = solver->statistics();
+    std::printf("jump      : attempts %llu  hits %llu  full solves %llu\n", static_cast<unsigned long long>(stats.warm_attempts),
+                static_cast<unsigned long long>(stats.warm_hits), static_cast<unsigned long long>(stats.full_solves));
+    check(stats.warm_attempts == FEATURES, "位姿跳变时每个特征尝试一次热启动");
+    check(stats.warm_hits + stats.full_solves == stats.warm_attempts, "命中数与回退次数之和等于热启动尝试次数");
+
+    // ---------------- 4. 关闭热启动 ----------------
+    solver->setWarmStart(false);
+    solver->resetStatistics();
+    check(solveAndCheck(observe(FRAMES + 11, 0.8)), "关闭热启动后的位姿与真值一致");
+    stats = solver->statistics();
+    check(stats.warm_attempts == 0 && stats.full_solves == FEATURES, "关闭热启动时只执行完整解算");
+
+    if (failures == 0)
+        std::printf("PASS\n");
+    return failures == 0 ? 0 : 1;
+}
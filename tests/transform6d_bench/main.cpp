@@ -0,0 +1,166 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core.hpp>
+
+#include "vis_core/math/pose_proc/transform6D.hpp"
+
+/**
+ * @brief Transform6D 复合与旋转形式转换的吞吐量对比
+ *
+ * 改动前的路径在测试中复现：旋转向量经 cv::Rodrigues 转换为旋转矩阵，复合使用 Matx 乘法
+ *
+ * 1. 复合：以旋转向量构造的位姿 (改动前需两次 cv::Rodrigues)；以旋转矩阵构造的位姿 (两者均为矩阵乘法)
+ * 2. 转换：rvec -> rmat、rmat -> rvec 的闭式公式与 cv::Rodrigues
+ * 3. 插值：slerp 的吞吐量
+ *
+ * 同时校验新旧路径的结果一致，不一致时返回非零
+ */
+
+constexpr int COUNT = 4096;             //!< 位姿数量
+constexpr int ROUNDS = 50;              //!< 重复次数
+constexpr double TOLERANCE = 1e-9;      //!< 新旧路径结果的允许误差
+
+template <typename Func>
+static double nsPerOp(Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(ROUNDS) * COUNT);
+}
+
+static void report(const char *name, double old_ns, double new_ns)
+{
+    std::printf("%-22s old %8.1f ns   new %8.1f ns   x%.2f\n", name, old_ns, new_ns, new_ns > 0 ? old_ns / new_ns : 0.0);
+}
+
+static double maxDiff(const cv::Matx33d &a, const cv::Matx33d &b)
+{
+    double diff = 0;
+    for (int i = 0; i < 9; ++i)
+        diff = std::max(diff, std::abs(a.val[i] - b.val[i]));
+    return diff;
+}
+
+int main()
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> angle(-2.0, 2.0), offset(-3.0, 3.0);
+    std::vector<cv::Vec3d> rvecs(COUNT), tvecs(COUNT);
+    std::vector<cv::Matx33d> rmats(COUNT);
+    for (int i = 0; i < COUNT; ++i)
+    {
+        rvecs[i] = cv::Vec3d(angle(rng), angle(rng), angle(rng));
+        tvecs[i] = cv::Vec3d(offset(rng), offset(rng), offset(rng));
+        cv::Rodrigues(rvecs[i], rmats[i]);
+    }
+
+    bool ok = true;
+    double sink = 0;
+
+    // ---------------- 复合：旋转向量构造 ----------------
+    std::vector<cv::Matx33d> old_result(COUNT), new_result(COUNT);
+    double old_rvec_compose = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            const int j = (i + 1) % COUNT;
+            cv::Matx33d r_ab, r_bc;
+            cv::Rodrigues(rvecs[i], r_ab);
+            cv::Rodrigues(rvecs[j], r_bc);
+            old_result[i] = r_ab * r_bc;
+            sink += (r_ab * tvecs[j] + tvecs[i])(0);
+        }
+    });
+    double new_rvec_compose = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            const int j = (i + 1) % COUNT;
+            const Transform6D composed = Transform6D(rvecs[i], tvecs[i]) + Transform6D(rvecs[j], tvecs[j]);
+            sink += composed.quat()(0) + composed.tvec()(0);
+        }
+    });
+    for (int i = 0; i < COUNT; ++i)
+    {
+        const int j = (i + 1) % COUNT;
+        new_result[i] = (Transform6D(rvecs[i], tvecs[i]) + Transform6D(rvecs[j], tvecs[j])).rmat();
+        ok &= maxDiff(old_result[i], new_result[i]) < TOLERANCE;
+    }
+    report("compose (rvec)", old_rvec_compose, new_rvec_compose);
+
+    // ---------------- 复合：旋转矩阵构造 ----------------
+    double old_rmat_compose = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            const int j = (i + 1) % COUNT;
+            old_result[i] = rmats[i] * rmats[j];
+            sink += (rmats[i] * tvecs[j] + tvecs[i])(0);
+        }
+    });
+    double new_rmat_compose = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            const int j = (i + 1) % COUNT;
+            const Transform6D composed = Transform6D(rmats[i], tvecs[i]) + Transform6D(rmats[j], tvecs[j]);
+            sink += composed.rmat()(0, 0) + composed.tvec()(0);
+        }
+    });
+    report("compose (rmat)", old_rmat_compose, new_rmat_compose);
+
+    // ---------------- 转换 ----------------
+    double old_rvec_to_rmat = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            cv::Matx33d r;
+            cv::Rodrigues(rvecs[i], r);
+            sink += r(0, 0);
+        }
+    });
+    double new_rvec_to_rmat = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+            sink += transform6D_utils::quatToRmat(transform6D_utils::rvecToQuat(rvecs[i]))(0, 0);
+    });
+    for (int i = 0; i < COUNT; ++i)
+        ok &= maxDiff(rmats[i], transform6D_utils::quatToRmat(transform6D_utils::rvecToQuat(rvecs[i]))) < TOLERANCE;
+    report("rvec -> rmat", old_rvec_to_rmat, new_rvec_to_rmat);
+
+    double old_rmat_to_rvec = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            cv::Vec3d r;
+            cv::Rodrigues(rmats[i], r);
+            sink += r(0);
+        }
+    });
+    double new_rmat_to_rvec = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+            sink += transform6D_utils::quatToRvec(transform6D_utils::rmatToQuat(rmats[i]))(0);
+    });
+    for (int i = 0; i < COUNT; ++i)
+    {
+        const cv::Vec3d rvec = transform6D_utils::quatToRvec(transform6D_utils::rmatToQuat(rmats[i]));
+        cv::Matx33d back;
+        cv::Rodrigues(rvec, back);
+        ok &= maxDiff(rmats[i], back) < TOLERANCE;
+    }
+    report("rmat -> rvec", old_rmat_to_rvec, new_rmat_to_rvec);
+
+    // ---------------- 插值 ----------------
+    std::vector<Transform6D::QuatType> quats(COUNT);
+    for (int i = 0; i < COUNT; ++i)
+        quats[i] = transform6D_utils::rvecToQuat(rvecs[i]);
+    double slerp_ns = nsPerOp([&] {
+        for (int i = 0; i < COUNT; ++i)
+            sink += transform6D_utils::slerp(quats[i], quats[(i + 1) % COUNT], 0.3)(0);
+    });
+    std::printf("%-22s new %8.1f ns\n", "slerp", slerp_ns);
+
+    std::printf("checksum %.3f\n", sink);
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "vis_core/math/pose_proc/transform6D.hpp"
+
+/**
+ * @brief Transform6D 并发读取的压力测试与各初始化模式的开销对比
+ *
+ * 1. 压力测试：8 个读取线程同时读取同一个 Atomic / Eager 位姿的 rmat、rvec、quat 并拷贝位姿，
+ *    校验读取结果与单线程计算的参考值一致
+ * 2. 开销对比：Lazy / Eager / Atomic 三种模式下构造位姿并读取旋转形式的耗时
+ *
+ * @note 建议同时以 -fsanitize=thread 编译运行，检查压力测试中不存在数据竞争
+ */
+
+constexpr int READER_COUNT = 8;          //!< 读取线程数量
+constexpr int STRESS_ROUNDS = 2000;      //!< 每种模式的压力测试轮数
+constexpr int BENCH_COUNT = 4096;        //!< 开销对比的位姿数量
+constexpr int BENCH_ROUNDS = 50;         //!< 开销对比的重复次数
+constexpr double TOLERANCE = 1e-12;      //!< 读取结果与参考值的允许误差
+
+using InitMode = Transform6D::InitMode;
+
+static const char *modeName(InitMode mode)
+{
+    switch (mode)
+    {
+    case InitMode::Lazy:
+        return "Lazy";
+    case InitMode::Eager:
+        return "Eager";
+    default:
+        return "Atomic";
+    }
+}
+
+template <typename A, typename B>
+static bool near(const A &a, const B &b, int n)
+{
+    for (int i = 0; i < n; ++i)
+        if (!(std::abs(a.val[i] - b.val[i]) < TOLERANCE))
+            return false;
+    return true;
+}
+
+/**
+ * @brief 多个线程同时读取同一位姿，返回不一致的次数
+ */
+static int stress(InitMode mode, const std::vector<cv::Vec3d> &rvecs, const std::vector<cv::Vec3d> &tvecs)
+{
+    std::vector<Transform6D> poses(rvecs.size());
+    Transform6D *shared = nullptr;
+    const Transform6D *reference = nullptr;
+    std::atomic<int> mismatches{0};
+    std::barrier sync(READER_COUNT + 1);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < READER_COUNT; ++t)
+    {
+        readers.emplace_back([&, t]
+                             {
+            for (int round = 0; round < STRESS_ROUNDS; ++round)
+            {
+                sync.arrive_and_wait(); // 主线程已准备好本轮位姿
+                // 不同线程以不同顺序首次访问各形式
+                bool ok = true;
+                switch ((t + round) % 3)
+                {
+                case 0:
+                    ok &= near(shared->rmat(), reference->rmat(), 9);
+                    ok &= near(shared->rvec(), reference->rvec(), 3);
+                    break;
+                case 1:
+                    ok &= near(shared->rvec(), reference->rvec(), 3);
+                    ok &= near(shared->quat(), reference->quat(), 4);
+                    break;
+                default:
+                {
+                    const Transform6D copy = *shared;
+                    ok &= near(copy.rmat(), reference->rmat(), 9);
+                    ok &= near(shared->quat(), reference->quat(), 4);
+                    break;
+                }
+                }
+                ok &= near(shared->tvec(), reference->tvec(), 3);
+                if (!ok)
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                sync.arrive_and_wait(); // 本轮读取结束
+            } });
+    }
+
+    for (int round = 0; round < STRESS_ROUNDS; ++round)
+    {
+        const size_t i = static_cast<size_t>(round) % rvecs.size();
+        Transform6D fresh(rvecs[i], tvecs[i], mode);
+        poses[i] = Transform6D(rvecs[i], tvecs[i], InitMode::Eager);
+        reference = &poses[i];
+        shared = &fresh;
+        sync.arrive_and_wait();
+        sync.arrive_and_wait();
+    }
+    for (auto &reader : readers)
+        reader.join();
+    return mismatches.load();
+}
+
+/**
+ * @brief 构造位姿并读取旋转形式的平均耗时 (ns)
+ */
+static double bench(InitMode mode, const std::vector<cv::Vec3d> &rvecs, const std::vector<cv::Vec3d> &tvecs, double &sink)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; ++r)
+    {
+        for (int i = 0; i < BENCH_COUNT; ++i)
+        {
+            const Transform6D pose(rvecs[i], tvecs[i], mode);
+            sink += pose.rmat()(0, 0) + pose.rmat()(1, 1);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(BENCH_ROUNDS) * BENCH_COUNT);
+}
+
+/**
+ * @brief 读取已初始化位姿的平均耗时 (ns)
+ */
+static double benchRead(InitMode mode, const std::vector<cv::Vec3d> &rvecs, const std::vector<cv::Vec3d> &tvecs, double &sink)
+{
+    std::vector<Transform6D> poses;
+    poses.reserve(BENCH_COUNT);
+    for (int i = 0; i < BENCH_COUNT; ++i)
+    {
+        poses.emplace_back(rvecs[i], tvecs[i], mode);
+        sink += poses.back().rmat()(0, 0);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; ++r)
+        for (const auto &pose : poses)
+            sink += pose.rmat()(0, 0);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(BENCH_ROUNDS) * BENCH_COUNT);
+}
+
+int main()
+{
+    std::mt19937 rng(43);
+    std::uniform_real_distribution<double> angle(-2.0, 2.0), offset(-3.0, 3.0);
+    std::vector<cv::Vec3d> rvecs(BENCH_COUNT), tvecs(BENCH_COUNT);
+    for (int i = 0; i < BENCH_COUNT; ++i)
+    {
+        rvecs[i] = cv::Vec3d(angle(rng), angle(rng), angle(rng));
+        tvecs[i] = cv::Vec3d(offset(rng), offset(rng), offset(rng));
+    }
+
+    int failures = 0;
+    for (InitMode mode : {InitMode::Atomic, InitMode::Eager})
+    {
+        const int mismatches = stress(mode, rvecs, tvecs);
+        std::printf("stress %-6s : %d readers x %d rounds, %d mismatches\n", modeName(mode), READER_COUNT, STRESS_ROUNDS, mismatches);
+        failures += mismatches;
+    }
+
+    double sink = 0;
+    for (InitMode mode : {InitMode::Lazy, InitMode::Eager, InitMode::Atomic})
+    {
+        const double construct_ns = bench(mode, rvecs, tvecs, sink);
+        const double read_ns = benchRead(mode, rvecs, tvecs, sink);
+        std::printf("bench  %-6s : construct + 2 x rmat() %6.1f ns, cached rmat() %5.2f ns\n", modeName(mode), construct_ns, read_ns);
+    }
+    std::printf("checksum %.3f\n", sink);
+
+    std::printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}